@@ -0,0 +1,75 @@
+#include <AML/Vector.hpp>
+#include <AML/Allocators.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace {
+
+template<class Allocator>
+using allocator_vector = aml::Vector<std::vector<float, Allocator>, aml::dynamic_extent>;
+
+template<class Allocator>
+void add_kernel(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const allocator_vector<Allocator> a(aml::size_initializer(size), 1.f);
+	const allocator_vector<Allocator> b(aml::size_initializer(size), 2.f);
+	allocator_vector<Allocator> c(aml::size_initializer(size), 0.f);
+	for (auto _ : state) {
+		aml::add(c, a, b);
+		benchmark::DoNotOptimize(c.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * std::int64_t{3 * sizeof(float)});
+}
+
+// The random reads of the 1 GiB vector miss the TLB with the ordinary pages
+template<class Allocator>
+void random_reads(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const allocator_vector<Allocator> a(aml::size_initializer(size), 1.f);
+	std::uint64_t x = 88172645463325252ull;
+	float sum = 0.f;
+	for (auto _ : state) {
+		for (int i = 0; i < 1024; ++i) {
+			x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+			sum += a[static_cast<std::size_t>(x % size)];
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * 1024);
+}
+
+// A frame of the short-lived temporaries of the element-wise operations
+template<class Allocator>
+void frame_temporaries(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	aml::arena frame_arena;
+	const allocator_vector<Allocator> a(aml::size_initializer(size), 1.f);
+	const allocator_vector<Allocator> b(aml::size_initializer(size), 2.f);
+	for (auto _ : state) {
+		float sum = 0.f;
+		for (int i = 0; i < 1000; ++i) {
+			const allocator_vector<Allocator> c = a + b * 2.f;
+			const allocator_vector<Allocator> d = c - a;
+			sum += d[0];
+		}
+		benchmark::DoNotOptimize(sum);
+		frame_arena.reset();
+	}
+	state.SetItemsProcessed(state.iterations() * 2000);
+}
+
+}
+
+BENCHMARK(frame_temporaries<std::allocator<float>>)->Arg(16)->Arg(256);
+BENCHMARK(frame_temporaries<aml::arena_allocator<float>>)->Arg(16)->Arg(256);
+BENCHMARK(add_kernel<std::allocator<float>>)->Arg(4099)->Arg(1 << 26);
+BENCHMARK(add_kernel<aml::aligned_allocator<float>>)->Arg(4099)->Arg(1 << 26);
+BENCHMARK(add_kernel<aml::huge_page_allocator<float>>)->Arg(4099)->Arg(1 << 26);
+BENCHMARK(random_reads<std::allocator<float>>)->Arg(1 << 28);
+BENCHMARK(random_reads<aml::huge_page_allocator<float>>)->Arg(1 << 28);
@@ -0,0 +1,75 @@
+#include <AML/Vector.hpp>
+#include <AML/BitVector.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t dimension = 768;
+
+aml::DVector<float> make_dvector(const std::size_t size, const float shift)
+{
+	aml::DVector<float> out{aml::size_initializer(size)};
+	for (std::size_t i = 0; i < size; ++i) {
+		out[i] = std::sin(static_cast<float>(i) * 0.37f + shift);
+	}
+	return out;
+}
+
+void float_scan(benchmark::State& state)
+{
+	const auto count = static_cast<std::size_t>(state.range(0));
+	const auto query = make_dvector(dimension, 0.f);
+	std::vector<aml::DVector<float>> database;
+	for (std::size_t c = 0; c < count; ++c) {
+		database.push_back(make_dvector(dimension, static_cast<float>(c) * 0.01f));
+	}
+	std::vector<float> out(count);
+	for (auto _ : state) {
+		for (std::size_t c = 0; c < count; ++c) {
+			out[c] = aml::dot(query, database[c]);
+		}
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void hamming_scan(benchmark::State& state)
+{
+	const auto count = static_cast<std::size_t>(state.range(0));
+	const aml::BitVector query(make_dvector(dimension, 0.f));
+	aml::BitVectorArray database(dimension);
+	for (std::size_t c = 0; c < count; ++c) {
+		database.push_back(make_dvector(dimension, static_cast<float>(c) * 0.01f));
+	}
+	std::vector<std::uint32_t> out(count);
+	for (auto _ : state) {
+		aml::hamming_scan(query, database, out.data());
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void binarize(benchmark::State& state)
+{
+	const auto vec = make_dvector(dimension, 0.f);
+	std::vector<std::uint64_t> out(dimension / 64);
+	for (auto _ : state) {
+		aml::binarize_n(vec.data(), vec.size(), out.data());
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * dimension);
+}
+
+}
+
+// 768-dimensional embeddings, the float database of 100000 vectors does not fit in the cache
+BENCHMARK(float_scan)->Arg(1000)->Arg(100000);
+BENCHMARK(hamming_scan)->Arg(1000)->Arg(100000);
+BENCHMARK(binarize);
@@ -0,0 +1,81 @@
+#include <AML/Blas.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace {
+
+aml::DVector<float> make_dvector(const std::size_t size, const float shift)
+{
+	aml::DVector<float> out{aml::size_initializer(size)};
+	for (std::size_t i = 0; i < size; ++i) {
+		out[i] = static_cast<float>(i % 17) + shift;
+	}
+	return out;
+}
+
+void blas_axpy(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto x = make_dvector(size, 1.f);
+	auto y = make_dvector(size, 2.f);
+	for (auto _ : state) {
+		aml::axpy(0.5f, x, y);
+		benchmark::DoNotOptimize(y.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void blas_nrm2(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto x = make_dvector(size, 1.f);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(x.data());
+		benchmark::DoNotOptimize(aml::nrm2(x));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void blas_asum(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto x = make_dvector(size, -8.f);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(x.data());
+		benchmark::DoNotOptimize(aml::asum(x));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void blas_iamax(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto x = make_dvector(size, -8.f);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(x.data());
+		benchmark::DoNotOptimize(aml::iamax(x));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void serial_nrm2(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto x = make_dvector(size, 1.f);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(x.data());
+		benchmark::DoNotOptimize(aml::dist(x));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+BENCHMARK(blas_axpy)->Arg(64)->Arg(4096);
+BENCHMARK(blas_nrm2)->Arg(64)->Arg(4096);
+BENCHMARK(serial_nrm2)->Arg(64)->Arg(4096);
+BENCHMARK(blas_asum)->Arg(64)->Arg(4096);
+BENCHMARK(blas_iamax)->Arg(64)->Arg(4096);
@@ -0,0 +1,26 @@
+#include <AML/Vector.hpp>
+#include <AML/Containers.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+// The short vectors created by the element-wise operations
+template<class Container>
+void small_temporaries(benchmark::State& state)
+{
+	using vector = aml::Vector<Container, aml::dynamic_extent>;
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const vector a(aml::size_initializer(size), 1.f);
+	const vector b(aml::size_initializer(size), 2.f);
+	for (auto _ : state) {
+		const vector c = a + b * 2.f;
+		benchmark::DoNotOptimize(aml::dot(c, a));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+}
+
+BENCHMARK(small_temporaries<std::vector<float>>)->Arg(3)->Arg(16)->Arg(64);
+BENCHMARK(small_temporaries<aml::small_vector<float, 16>>)->Arg(3)->Arg(16)->Arg(64);
@@ -0,0 +1,95 @@
+#include <AML/Vector.hpp>
+#include <AML/Conversions.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+template<class T>
+std::vector<T> make_values(const std::size_t size)
+{
+	std::vector<T> out(size);
+	for (std::size_t i = 0; i < size; ++i) {
+		out[i] = static_cast<T>(std::sin(static_cast<double>(i)) * 100.);
+	}
+	return out;
+}
+
+// The element by element cast, which the converting constructors used
+template<class From, class To>
+void convert_cast(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto values = make_values<From>(size);
+	std::vector<To> out(size);
+	for (auto _ : state) {
+		std::transform(values.begin(), values.end(), out.begin(), [](const From val) { return static_cast<To>(val); });
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// The rounding to the nearest by the standard library
+template<class From, class To>
+void convert_lrint(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto values = make_values<From>(size);
+	std::vector<To> out(size);
+	for (auto _ : state) {
+		std::transform(values.begin(), values.end(), out.begin(), [](const From val) { return static_cast<To>(std::lrint(val)); });
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class From, class To, aml::rounding Mode>
+void convert_bulk(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto values = make_values<From>(size);
+	std::vector<To> out(size);
+	for (auto _ : state) {
+		aml::convert_n(values.data(), size, out.data(), Mode);
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void dvector_cast(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	aml::DVector<float> vec{aml::size_initializer(size)};
+	const auto values = make_values<float>(size);
+	std::copy(values.begin(), values.end(), vec.begin());
+	for (auto _ : state) {
+		const aml::DVector<std::int16_t> out(vec);
+		benchmark::DoNotOptimize(out.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+BENCHMARK(convert_cast<float, std::int32_t>)->Arg(4096);
+BENCHMARK(convert_bulk<float, std::int32_t, aml::rounding::truncate>)->Arg(4096);
+BENCHMARK(convert_lrint<float, std::int32_t>)->Arg(4096);
+BENCHMARK(convert_bulk<float, std::int32_t, aml::rounding::nearest_even>)->Arg(4096);
+BENCHMARK(convert_bulk<float, std::int32_t, aml::rounding::floor>)->Arg(4096);
+BENCHMARK(convert_cast<float, std::int16_t>)->Arg(4096);
+BENCHMARK(convert_bulk<float, std::int16_t, aml::rounding::truncate>)->Arg(4096);
+BENCHMARK(convert_cast<float, std::uint8_t>)->Arg(4096);
+BENCHMARK(convert_bulk<float, std::uint8_t, aml::rounding::truncate>)->Arg(4096);
+BENCHMARK(convert_cast<double, std::int32_t>)->Arg(4096);
+BENCHMARK(convert_bulk<double, std::int32_t, aml::rounding::truncate>)->Arg(4096);
+BENCHMARK(convert_cast<float, double>)->Arg(4096);
+BENCHMARK(convert_bulk<float, double, aml::rounding::truncate>)->Arg(4096);
+BENCHMARK(dvector_cast)->Arg(4096);
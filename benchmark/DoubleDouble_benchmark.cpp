@@ -0,0 +1,77 @@
+#include <AML/Vector.hpp>
+#include <AML/DoubleDouble.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+
+namespace {
+
+aml::DVector<double> make_dvector(const std::size_t size, const double shift)
+{
+	aml::DVector<double> out{aml::size_initializer(size)};
+	for (std::size_t i = 0; i < size; ++i) {
+		out[i] = std::sin(static_cast<double>(i) * 0.37 + shift) * 1e3;
+	}
+	return out;
+}
+
+void dot_double(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 0.);
+	const auto b = make_dvector(size, 1.);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(aml::dot(a, b));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void dot_double_double(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 0.);
+	const auto b = make_dvector(size, 1.);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(aml::compensated_dot(a, b));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class T>
+void dot_wide(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 0.);
+	const auto b = make_dvector(size, 1.);
+	for (auto _ : state) {
+		T out = 0;
+		for (std::size_t i = 0; i < size; ++i) {
+			out += static_cast<T>(a[i]) * static_cast<T>(b[i]);
+		}
+		benchmark::DoNotOptimize(out);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void sum_double_double(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 0.);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(aml::compensated_sum(a));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+BENCHMARK(dot_double)->Arg(1 << 16);
+BENCHMARK(dot_double_double)->Arg(1 << 16);
+BENCHMARK(dot_wide<long double>)->Arg(1 << 16);
+// The software quadruple precision of the compiler runtime
+#ifdef __SIZEOF_FLOAT128__
+BENCHMARK(dot_wide<__float128>)->Arg(1 << 16);
+#endif
+BENCHMARK(sum_double_double)->Arg(1 << 16);
@@ -0,0 +1,55 @@
+#include <AML/Vector.hpp>
+#include <AML/HalfFloat.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+template<class T>
+aml::DVector<T> make_dvector(const std::size_t size, const float shift)
+{
+	aml::DVector<T> out{aml::size_initializer(size)};
+	for (std::size_t i = 0; i < size; ++i) {
+		out[i] = T(static_cast<float>(i % 17) * 0.125f + shift);
+	}
+	return out;
+}
+
+template<class T>
+void half_dot(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector<T>(size, 1.f);
+	const auto b = make_dvector<T>(size, -1.f);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a.data());
+		benchmark::DoNotOptimize(aml::dot(a, b));
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * 2 * static_cast<std::int64_t>(sizeof(T)));
+}
+
+template<class T>
+void half_convert(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector<T>(size, 1.f);
+	std::vector<float> out(size);
+	for (auto _ : state) {
+		aml::convert_n(a.data(), size, out.data());
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+// The vectors of 16M elements do not fit in the cache, the half precision numbers halve the memory traffic
+BENCHMARK(half_dot<float>)->Arg(1024)->Arg(1 << 24);
+BENCHMARK(half_dot<aml::float16>)->Arg(1024)->Arg(1 << 24);
+BENCHMARK(half_dot<aml::bfloat16>)->Arg(1024)->Arg(1 << 24);
+BENCHMARK(half_convert<aml::float16>)->Arg(1024);
+BENCHMARK(half_convert<aml::bfloat16>)->Arg(1024);
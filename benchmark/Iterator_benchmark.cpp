@@ -0,0 +1,107 @@
+#include <AML/Vector.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t vector_count = 4096;
+
+template<class Vec>
+std::vector<Vec> make_vectors()
+{
+	std::vector<Vec> out(vector_count);
+	for (std::size_t i = 0; i < out.size(); ++i) {
+		for (std::size_t j = 0; j < Vec::static_size; ++j) {
+			out[i][j] = static_cast<typename Vec::value_type>(i + j);
+		}
+	}
+	return out;
+}
+
+// The iterator of the named field vectors before AML_CONTIGUOUS_VECTOR
+template<class Vec>
+auto index_begin(const Vec& vec) noexcept { return aml::ConstIndexIterator<Vec>(vec, 0); }
+template<class Vec>
+auto index_end(const Vec& vec) noexcept { return aml::ConstIndexIterator<Vec>(vec, Vec::static_size); }
+
+template<class Vec, bool UsePointer>
+void accumulate(benchmark::State& state)
+{
+	const auto vectors = make_vectors<Vec>();
+	for (auto _ : state) {
+		typename Vec::value_type sum = 0;
+		for (const auto& vec : vectors) {
+			if constexpr (UsePointer) {
+				sum = std::accumulate(vec.begin(), vec.end(), sum);
+			} else {
+				sum = std::accumulate(index_begin(vec), index_end(vec), sum);
+			}
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * vector_count));
+}
+
+template<class Vec, bool UsePointer>
+void copy(benchmark::State& state)
+{
+	const auto vectors = make_vectors<Vec>();
+	std::vector<typename Vec::value_type> out(vector_count * Vec::static_size);
+	for (auto _ : state) {
+		auto it = out.begin();
+		for (const auto& vec : vectors) {
+			if constexpr (UsePointer) {
+				it = std::copy(vec.begin(), vec.end(), it);
+			} else {
+				it = std::copy(index_begin(vec), index_end(vec), it);
+			}
+		}
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * vector_count));
+}
+
+template<class Vec, bool UsePointer>
+void transform(benchmark::State& state)
+{
+	const auto vectors = make_vectors<Vec>();
+	std::vector<Vec> out(vector_count);
+	for (auto _ : state) {
+		for (std::size_t i = 0; i < vector_count; ++i) {
+			const auto twice = [](const auto val) { return val + val; };
+			if constexpr (UsePointer) {
+				std::transform(vectors[i].begin(), vectors[i].end(), out[i].begin(), twice);
+			} else {
+				std::transform(index_begin(vectors[i]), index_end(vectors[i]), aml::IndexIterator<Vec>(out[i], 0), twice);
+			}
+		}
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * vector_count));
+}
+
+using aml::Vector;
+
+BENCHMARK_TEMPLATE(accumulate, Vector<float, 3>, false);
+BENCHMARK_TEMPLATE(accumulate, Vector<float, 3>, true);
+BENCHMARK_TEMPLATE(accumulate, Vector<int, 4>, false);
+BENCHMARK_TEMPLATE(accumulate, Vector<int, 4>, true);
+
+BENCHMARK_TEMPLATE(copy, Vector<float, 3>, false);
+BENCHMARK_TEMPLATE(copy, Vector<float, 3>, true);
+BENCHMARK_TEMPLATE(copy, Vector<double, 4>, false);
+BENCHMARK_TEMPLATE(copy, Vector<double, 4>, true);
+
+BENCHMARK_TEMPLATE(transform, Vector<float, 4>, false);
+BENCHMARK_TEMPLATE(transform, Vector<float, 4>, true);
+BENCHMARK_TEMPLATE(transform, Vector<int, 5>, false);
+BENCHMARK_TEMPLATE(transform, Vector<int, 5>, true);
+
+}
@@ -0,0 +1,102 @@
+#include <AML/Vector.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace {
+
+aml::DVector<float> make_dvector(const std::size_t size, const float shift)
+{
+	aml::DVector<float> out{aml::size_initializer(size)};
+	for (std::size_t i = 0; i < size; ++i) {
+		out[i] = static_cast<float>(i % 17) + shift;
+	}
+	return out;
+}
+
+void dynamic_add_operator(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 1.f);
+	const auto b = make_dvector(size, 2.f);
+	for (auto _ : state) {
+		aml::DVector<float> c = a + b;
+		benchmark::DoNotOptimize(c.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void dynamic_add_kernel(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 1.f);
+	const auto b = make_dvector(size, 2.f);
+	auto c = make_dvector(size, 0.f);
+	for (auto _ : state) {
+		aml::add(c, a, b);
+		benchmark::DoNotOptimize(c.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void dynamic_normalize_operator(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 1.f);
+	for (auto _ : state) {
+		aml::DVector<float> c = aml::normalize(a);
+		benchmark::DoNotOptimize(c.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void dynamic_normalize_kernel(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 1.f);
+	auto c = make_dvector(size, 0.f);
+	for (auto _ : state) {
+		aml::normalize_into(c, a);
+		benchmark::DoNotOptimize(c.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void dynamic_cross_operator(benchmark::State& state)
+{
+	const aml::DVector<float> a(1.f, 2.f, 3.f);
+	const aml::DVector<float> b(4.f, 5.f, 6.f);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a.data());
+		aml::DVector<float> c = aml::cross(a, b);
+		benchmark::DoNotOptimize(c.data());
+		benchmark::ClobberMemory();
+	}
+}
+
+void dynamic_cross_kernel(benchmark::State& state)
+{
+	const aml::DVector<float> a(1.f, 2.f, 3.f);
+	const aml::DVector<float> b(4.f, 5.f, 6.f);
+	aml::DVector<float> c(aml::size_initializer(3));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a.data());
+		aml::cross_into(c, a, b);
+		benchmark::DoNotOptimize(c.data());
+		benchmark::ClobberMemory();
+	}
+}
+
+}
+
+BENCHMARK(dynamic_add_operator)->Arg(4)->Arg(64)->Arg(4096);
+BENCHMARK(dynamic_add_kernel)->Arg(4)->Arg(64)->Arg(4096);
+BENCHMARK(dynamic_normalize_operator)->Arg(4)->Arg(64)->Arg(4096);
+BENCHMARK(dynamic_normalize_kernel)->Arg(4)->Arg(64)->Arg(4096);
+BENCHMARK(dynamic_cross_operator);
+BENCHMARK(dynamic_cross_kernel);
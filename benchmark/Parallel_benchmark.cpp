@@ -0,0 +1,73 @@
+#include <AML/Parallel.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace {
+
+aml::DVector<float> make_dvector(const std::size_t size, const float shift)
+{
+	aml::DVector<float> out{aml::size_initializer(size)};
+	for (std::size_t i = 0; i < size; ++i) {
+		out[i] = static_cast<float>(i % 17) * 0.125f + shift;
+	}
+	return out;
+}
+
+void serial_dot(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 1.f);
+	const auto b = make_dvector(size, -1.f);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(aml::dot(a, b));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void parallel_dot(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 1.f);
+	const auto b = make_dvector(size, -1.f);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(aml::dot(aml::par, a, b));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void serial_axpy(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 1.f);
+	const auto b = make_dvector(size, -1.f);
+	auto c = make_dvector(size, 0.f);
+	for (auto _ : state) {
+		c = a + b * 2.f;
+		benchmark::DoNotOptimize(c.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void parallel_axpy(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 1.f);
+	const auto b = make_dvector(size, -1.f);
+	auto c = make_dvector(size, 0.f);
+	for (auto _ : state) {
+		aml::assign(aml::par, c, a + b * 2.f);
+		benchmark::DoNotOptimize(c.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+BENCHMARK(serial_dot)->Arg(1 << 16)->Arg(1 << 24);
+BENCHMARK(parallel_dot)->Arg(1 << 16)->Arg(1 << 24)->UseRealTime();
+BENCHMARK(serial_axpy)->Arg(1 << 16)->Arg(1 << 24);
+BENCHMARK(parallel_axpy)->Arg(1 << 16)->Arg(1 << 24)->UseRealTime();
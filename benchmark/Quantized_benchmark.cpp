@@ -0,0 +1,62 @@
+#include <AML/Vector.hpp>
+#include <AML/Quantized.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+namespace {
+
+aml::DVector<float> make_dvector(const std::size_t size, const float shift)
+{
+	aml::DVector<float> out{aml::size_initializer(size)};
+	for (std::size_t i = 0; i < size; ++i) {
+		out[i] = std::sin(static_cast<float>(i) * 0.37f + shift) + shift;
+	}
+	return out;
+}
+
+void float_dot(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 0.25f);
+	const auto b = make_dvector(size, -0.5f);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a.data());
+		benchmark::DoNotOptimize(aml::dot(a, b));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void quantized_dot(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const aml::QuantizedVector a(make_dvector(size, 0.25f));
+	const aml::QuantizedVector b(make_dvector(size, -0.5f));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a.data());
+		benchmark::DoNotOptimize(aml::quantized_dot(a, b));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void quantize(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 0.25f);
+	const auto params = aml::choose_quantization(a.data(), size);
+	std::vector<std::int8_t> codes(size);
+	for (auto _ : state) {
+		aml::quantize_n(a.data(), size, params, codes.data());
+		benchmark::DoNotOptimize(codes.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+// 768 and 1024 are the sizes of the embeddings, the vectors of 16M elements do not fit in the cache
+BENCHMARK(float_dot)->Arg(768)->Arg(1024)->Arg(1 << 24);
+BENCHMARK(quantized_dot)->Arg(768)->Arg(1024)->Arg(1 << 24);
+BENCHMARK(quantize)->Arg(1024);
@@ -0,0 +1,70 @@
+#include <AML/Vector.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <numeric>
+
+namespace {
+
+aml::DVector<float> make_dvector(const std::size_t size, const float shift)
+{
+	aml::DVector<float> out{aml::size_initializer(size)};
+	for (std::size_t i = 0; i < size; ++i) {
+		out[i] = static_cast<float>(i % 17) * 0.125f + shift;
+	}
+	return out;
+}
+
+void serial_dot(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 1.f);
+	const auto b = make_dvector(size, -1.f);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a.data());
+		benchmark::DoNotOptimize(std::inner_product(a.data(), a.data() + size, b.data(), 0.f));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void vector_dot(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 1.f);
+	const auto b = make_dvector(size, -1.f);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a.data());
+		benchmark::DoNotOptimize(aml::dot(a, b));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void vector_sum_of(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 1.f);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a.data());
+		benchmark::DoNotOptimize(aml::sum_of(a));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void vector_dist(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 1.f);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a.data());
+		benchmark::DoNotOptimize(aml::dist(a));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+BENCHMARK(serial_dot)->Arg(16)->Arg(1024)->Arg(65536);
+BENCHMARK(vector_dot)->Arg(4)->Arg(7)->Arg(16)->Arg(1024)->Arg(65536);
+BENCHMARK(vector_sum_of)->Arg(16)->Arg(1024)->Arg(65536);
+BENCHMARK(vector_dist)->Arg(4)->Arg(7)->Arg(16)->Arg(1024)->Arg(65536);
@@ -0,0 +1,71 @@
+#include <AML/Vector.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace {
+
+template<class Vec>
+Vec make_vector(const typename Vec::value_type shift) noexcept
+{
+	Vec out;
+	for (std::size_t i = 0; i < Vec::static_size; ++i) {
+		out[i] = static_cast<typename Vec::value_type>(i % 17) + shift;
+	}
+	return out;
+}
+
+template<class Vec>
+void static_add(benchmark::State& state)
+{
+	const Vec a = make_vector<Vec>(1);
+	const Vec b = make_vector<Vec>(2);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a);
+		Vec c = a + b * 2.f;
+		benchmark::DoNotOptimize(c);
+	}
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Vec::static_size));
+}
+
+template<class Vec>
+void static_add_assign(benchmark::State& state)
+{
+	Vec a = make_vector<Vec>(1);
+	const Vec b = make_vector<Vec>(2);
+	for (auto _ : state) {
+		a += b;
+		a -= b;
+		benchmark::DoNotOptimize(a);
+	}
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Vec::static_size));
+}
+
+template<class Vec>
+void static_dot(benchmark::State& state)
+{
+	const Vec a = make_vector<Vec>(1);
+	const Vec b = make_vector<Vec>(2);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a);
+		benchmark::DoNotOptimize(aml::dot(a, b));
+	}
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Vec::static_size));
+}
+
+using aml::Vector;
+
+BENCHMARK_TEMPLATE(static_add, Vector<float, 8>);
+BENCHMARK_TEMPLATE(static_add, Vector<float, 64>);
+BENCHMARK_TEMPLATE(static_add, Vector<float, 512>);
+BENCHMARK_TEMPLATE(static_add, Vector<double, 256>);
+
+BENCHMARK_TEMPLATE(static_add_assign, Vector<float, 64>);
+BENCHMARK_TEMPLATE(static_add_assign, Vector<float, 512>);
+
+BENCHMARK_TEMPLATE(static_dot, Vector<float, 64>);
+BENCHMARK_TEMPLATE(static_dot, Vector<float, 512>);
+BENCHMARK_TEMPLATE(static_dot, Vector<double, 256>);
+
+}
@@ -0,0 +1,78 @@
+#include <AML/Vector.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <functional>
+
+namespace {
+
+// 1 GiB operands are larger than the last level cache, so the outputs above AML_STREAMING_THRESHOLD use the non-temporal stores
+constexpr std::int64_t gigabyte_floats = (std::int64_t{1} << 30) / sizeof(float);
+
+aml::DVector<float> make_dvector(const std::size_t size, const float shift)
+{
+	aml::DVector<float> out{aml::size_initializer(size)};
+	for (std::size_t i = 0; i < size; ++i) {
+		out[i] = static_cast<float>(i % 17) + shift;
+	}
+	return out;
+}
+
+void set_bandwidth(benchmark::State& state)
+{
+	// Two operands are read and the output is written
+	state.SetBytesProcessed(state.iterations() * state.range(0) * std::int64_t{3 * sizeof(float)});
+}
+
+void ordinary_stores_add(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 1.f);
+	const auto b = make_dvector(size, 2.f);
+	auto c = make_dvector(size, 0.f);
+	for (auto _ : state) {
+		std::transform(a.data(), a.data() + size, b.data(), c.data(), std::plus<>{});
+		benchmark::DoNotOptimize(c.data());
+		benchmark::ClobberMemory();
+	}
+	set_bandwidth(state);
+}
+
+void streaming_add_kernel(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 1.f);
+	const auto b = make_dvector(size, 2.f);
+	auto c = make_dvector(size, 0.f);
+	for (auto _ : state) {
+		aml::add(c, a, b);
+		benchmark::DoNotOptimize(c.data());
+		benchmark::ClobberMemory();
+	}
+	set_bandwidth(state);
+}
+
+void streaming_add_operator(benchmark::State& state)
+{
+	const auto size = static_cast<std::size_t>(state.range(0));
+	const auto a = make_dvector(size, 1.f);
+	const auto b = make_dvector(size, 2.f);
+	auto c = make_dvector(size, 0.f);
+	for (auto _ : state) {
+		c = a + b;
+		benchmark::DoNotOptimize(c.data());
+		benchmark::ClobberMemory();
+	}
+	set_bandwidth(state);
+}
+
+}
+
+// The cached size runs first, so its buffers are not affected by the fragmentation after the large allocations
+BENCHMARK(ordinary_stores_add)->Arg(gigabyte_floats / 64)->Unit(benchmark::kMillisecond);
+BENCHMARK(streaming_add_kernel)->Arg(gigabyte_floats / 64)->Unit(benchmark::kMillisecond);
+BENCHMARK(streaming_add_operator)->Arg(gigabyte_floats / 64)->Unit(benchmark::kMillisecond);
+BENCHMARK(ordinary_stores_add)->Arg(gigabyte_floats)->Unit(benchmark::kMillisecond);
+BENCHMARK(streaming_add_kernel)->Arg(gigabyte_floats)->Unit(benchmark::kMillisecond);
+BENCHMARK(streaming_add_operator)->Arg(gigabyte_floats)->Unit(benchmark::kMillisecond);
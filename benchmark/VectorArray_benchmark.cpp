@@ -0,0 +1,104 @@
+#include <AML/VectorArray.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+std::vector<aml::Vector<float, 3>> make_vectors(const std::size_t count)
+{
+	std::vector<aml::Vector<float, 3>> out(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		const auto v = static_cast<float>(i % 17);
+		out[i] = aml::Vector(v + 1.f, v + 2.f, v + 3.f);
+	}
+	return out;
+}
+
+// One vector at a time over the array of structures
+void aos_normalize(benchmark::State& state)
+{
+	const auto vecs = make_vectors(static_cast<std::size_t>(state.range(0)));
+	std::vector<aml::Vector<float, 3>> out(vecs.size());
+	for (auto _ : state) {
+		for (std::size_t i = 0; i < vecs.size(); ++i) {
+			out[i] = aml::normalize(vecs[i]);
+		}
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void soa_normalize(benchmark::State& state)
+{
+	const aml::VectorArray<float, 3> vecs(make_vectors(static_cast<std::size_t>(state.range(0))));
+	for (auto _ : state) {
+		auto out = aml::normalize_each(vecs);
+		benchmark::DoNotOptimize(out.column(0));
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void aos_dot(benchmark::State& state)
+{
+	const auto a = make_vectors(static_cast<std::size_t>(state.range(0)));
+	const auto b = make_vectors(static_cast<std::size_t>(state.range(0)));
+	std::vector<float> out(a.size());
+	for (auto _ : state) {
+		for (std::size_t i = 0; i < a.size(); ++i) {
+			out[i] = aml::dot(a[i], b[i]);
+		}
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void soa_dot(benchmark::State& state)
+{
+	const aml::VectorArray<float, 3> a(make_vectors(static_cast<std::size_t>(state.range(0))));
+	const aml::VectorArray<float, 3> b(make_vectors(static_cast<std::size_t>(state.range(0))));
+	for (auto _ : state) {
+		auto out = aml::dot_each(a, b);
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void transpose_to_soa(benchmark::State& state)
+{
+	const auto vecs = make_vectors(static_cast<std::size_t>(state.range(0)));
+	aml::VectorArray<float, 3> soa;
+	for (auto _ : state) {
+		aml::transpose_to_soa(vecs.data(), vecs.size(), soa);
+		benchmark::DoNotOptimize(soa.column(0));
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(aml::Vector<float, 3>)));
+}
+
+void transpose_to_aos(benchmark::State& state)
+{
+	const aml::VectorArray<float, 3> soa(make_vectors(static_cast<std::size_t>(state.range(0))));
+	std::vector<aml::Vector<float, 3>> aos(soa.size());
+	for (auto _ : state) {
+		aml::transpose_to_aos(soa, aos.data());
+		benchmark::DoNotOptimize(aos.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(aml::Vector<float, 3>)));
+}
+
+}
+
+BENCHMARK(aos_normalize)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(soa_normalize)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(aos_dot)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(soa_dot)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(transpose_to_soa)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(transpose_to_aos)->Arg(1 << 10)->Arg(1 << 20);
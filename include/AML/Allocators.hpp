@@ -0,0 +1,453 @@
+/** @file */
+#pragma once
+
+#include <AML/Tools.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+	#include <sys/mman.h>
+#endif
+
+#ifdef AML_LIBRARY
+	#define AML_LIBRARY_ALLOCATORS
+#else
+	#error AML library is required
+#endif
+
+/// Size of the huge page which aml::huge_page_allocator rounds the large allocations to. Must be the default huge page size of the system
+#ifndef AML_HUGE_PAGE_SIZE
+	#define AML_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+#endif
+
+namespace aml
+{
+
+namespace detail
+{
+	template<class T>
+	std::size_t allocation_bytes(const std::size_t count)
+	{
+		if (count > (std::numeric_limits<std::size_t>::max() / sizeof(T))) {
+			throw std::bad_array_new_length();
+		}
+		return count * sizeof(T);
+	}
+}
+
+/**
+	@brief Allocator adaptor that default-initializes elements instead of value-initializing them
+	@details @c resize and @c aml::size_initializer do not zero-fill the buffer of trivial types,
+			 so the operations that overwrite every element write the memory only once
+
+	@tparam T The value type
+	@tparam Allocator The adapted allocator
+
+	@see aml::uninitialized
+*/
+template<class T, class Allocator = std::allocator<T>>
+class default_init_allocator : public Allocator
+{
+	using traits = std::allocator_traits<Allocator>;
+public:
+
+	using value_type = T;
+
+	template<class U>
+	struct rebind {
+		using other = default_init_allocator<U, typename traits::template rebind_alloc<U>>;
+		using type = other;
+	};
+
+	using Allocator::Allocator;
+
+	default_init_allocator() = default;
+
+	template<class U, class A>
+	default_init_allocator(const default_init_allocator<U, A>& other) noexcept
+		: Allocator(static_cast<const A&>(other)) {}
+
+	template<class U>
+	void construct(U* const ptr) noexcept(std::is_nothrow_default_constructible_v<U>) {
+		::new(static_cast<void*>(ptr)) U;
+	}
+
+	template<class U, class... Args>
+	void construct(U* const ptr, Args&&... args) {
+		traits::construct(static_cast<Allocator&>(*this), ptr, std::forward<Args>(args)...);
+	}
+};
+
+/**
+	@brief Allocator that aligns the elements to @p Align bytes
+	@details The vectors with this allocator tell the compiler the alignment of their elements, 
+			 so the vectorized loops need no peeling. The results of the operations keep the allocator through aml::rebind
+
+	@tparam T The value type
+	@tparam Align The alignment, power of two which is not less than the alignment of @p T
+
+	@see aml::huge_page_allocator
+*/
+template<class T, std::size_t Align = 64>
+class aligned_allocator
+{
+	static_assert((Align & (Align - 1)) == 0, "The alignment must be a power of two");
+	static_assert(Align >= alignof(T), "The alignment must not be less than the alignment of the type");
+public:
+
+	using value_type = T;
+	using is_always_equal = std::true_type;
+
+	/// The alignment of the allocated memory
+	static constexpr std::size_t alignment = Align;
+
+	template<class U>
+	struct rebind {
+		using other = aligned_allocator<U, Align>;
+		using type = other;
+	};
+
+	aligned_allocator() = default;
+
+	template<class U>
+	aligned_allocator(const aligned_allocator<U, Align>&) noexcept {}
+
+	[[nodiscard]]
+	T* allocate(const std::size_t count) {
+		return static_cast<T*>(::operator new(detail::allocation_bytes<T>(count), std::align_val_t{Align}));
+	}
+
+	void deallocate(T* const ptr, [[maybe_unused]] const std::size_t count) noexcept {
+		::operator delete(ptr, std::align_val_t{Align});
+	}
+
+	template<class U>
+	friend bool operator==(const aligned_allocator&, const aligned_allocator<U, Align>&) noexcept { return true; }
+	template<class U>
+	friend bool operator!=(const aligned_allocator&, const aligned_allocator<U, Align>&) noexcept { return false; }
+};
+
+/**
+	@brief Allocator that backs the large allocations with the huge pages
+	@details The allocations of #AML_HUGE_PAGE_SIZE bytes or more are mapped with @c MAP_HUGETLB.
+			 If the system has no reserved huge pages, the memory is mapped with the ordinary pages aligned to the huge page 
+			 and @c madvise(MADV_HUGEPAGE) asks for the transparent huge pages. 
+			 The huge pages cut the TLB misses of the multi-gigabyte vectors.
+			 The smaller allocations and the allocations on the systems other than Linux are aligned to 64 bytes like aml::aligned_allocator
+	@throw std::bad_alloc if the memory cannot be mapped
+
+	@tparam T The value type
+*/
+template<class T>
+class huge_page_allocator
+{
+public:
+
+	using value_type = T;
+	using is_always_equal = std::true_type;
+
+	/// The alignment of the allocated memory
+	static constexpr std::size_t alignment = (alignof(T) > 64) ? alignof(T) : 64;
+
+	template<class U>
+	struct rebind {
+		using other = huge_page_allocator<U>;
+		using type = other;
+	};
+
+	huge_page_allocator() = default;
+
+	template<class U>
+	huge_page_allocator(const huge_page_allocator<U>&) noexcept {}
+
+	[[nodiscard]]
+	T* allocate(const std::size_t count)
+	{
+		const std::size_t bytes = detail::allocation_bytes<T>(count);
+#if defined(__linux__)
+		if (bytes >= AML_HUGE_PAGE_SIZE) {
+			return static_cast<T*>(huge_page_allocator::map(huge_page_allocator::round_up(bytes)));
+		}
+#endif
+		return static_cast<T*>(::operator new(bytes, std::align_val_t{alignment}));
+	}
+
+	void deallocate(T* const ptr, const std::size_t count) noexcept
+	{
+#if defined(__linux__)
+		const std::size_t bytes = count * sizeof(T);
+		if (bytes >= AML_HUGE_PAGE_SIZE) {
+			::munmap(ptr, huge_page_allocator::round_up(bytes));
+			return;
+		}
+#else
+		static_cast<void>(count);
+#endif
+		::operator delete(ptr, std::align_val_t{alignment});
+	}
+
+	template<class U>
+	friend bool operator==(const huge_page_allocator&, const huge_page_allocator<U>&) noexcept { return true; }
+	template<class U>
+	friend bool operator!=(const huge_page_allocator&, const huge_page_allocator<U>&) noexcept { return false; }
+
+private:
+#if defined(__linux__)
+	static std::size_t round_up(const std::size_t bytes) noexcept {
+		return ((bytes + AML_HUGE_PAGE_SIZE - 1) / AML_HUGE_PAGE_SIZE) * AML_HUGE_PAGE_SIZE;
+	}
+
+	static void* map(const std::size_t bytes)
+	{
+		constexpr int protection = PROT_READ | PROT_WRITE;
+		constexpr int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_HUGETLB
+		void* const huge = ::mmap(nullptr, bytes, protection, flags | MAP_HUGETLB, -1, 0);
+		if (huge != MAP_FAILED) {
+			return huge;
+		}
+#endif
+		// The mapping is extended by the huge page and trimmed, so the transparent huge pages can back it from the start
+		const std::size_t extended = bytes + AML_HUGE_PAGE_SIZE;
+		void* const mapped = ::mmap(nullptr, extended, protection, flags, -1, 0);
+		if (mapped == MAP_FAILED) {
+			throw std::bad_alloc();
+		}
+
+		const auto address = reinterpret_cast<std::uintptr_t>(mapped);
+		const std::uintptr_t aligned = (address + AML_HUGE_PAGE_SIZE - 1) & ~static_cast<std::uintptr_t>(AML_HUGE_PAGE_SIZE - 1);
+		if (aligned != address) {
+			::munmap(mapped, aligned - address);
+		}
+		const std::size_t tail = extended - (aligned - address) - bytes;
+		if (tail != 0) {
+			::munmap(reinterpret_cast<void*>(aligned + bytes), tail);
+		}
+#ifdef MADV_HUGEPAGE
+		::madvise(reinterpret_cast<void*>(aligned), bytes, MADV_HUGEPAGE);
+#endif
+		return reinterpret_cast<void*>(aligned);
+	}
+#endif
+};
+
+/**
+	@brief Monotonic buffer for the temporary vectors
+	@details The memory is taken from the blocks by bumping the offset and is released all at once by reset(), 
+			 which keeps the blocks for the next use. While the arena is alive, it is the current arena of its thread,
+			 so the vectors with aml::arena_allocator and the results of their operations allocate from it.
+			 The arenas are scoped: the previous current arena is restored when the arena is destroyed
+	@warning Not thread-safe. The vectors allocated from the arena must not be used after reset() or after the arena is destroyed
+
+	@see aml::arena_allocator
+*/
+class arena
+{
+	struct Block
+	{
+		Block* next;
+		std::size_t size;
+	};
+public:
+
+	/**
+		@brief Creates the arena which allocates the blocks of @p block_size bytes and makes it the current arena of the thread
+	*/
+	explicit arena(const std::size_t block_size = 1 << 20) noexcept
+		: m_block_size(block_size), m_previous(arena::current_ref())
+	{
+		arena::current_ref() = this;
+	}
+
+	arena(const arena&) = delete;
+	arena& operator=(const arena&) = delete;
+
+	~arena() noexcept
+	{
+		arena::current_ref() = m_previous;
+		Block* block = m_first;
+		while (block != nullptr) {
+			Block* const next = block->next;
+			::operator delete(block);
+			block = next;
+		}
+	}
+
+	/**
+		@brief Allocates @p bytes aligned to @p align bytes
+		@throw std::bad_alloc if the new block cannot be allocated
+	*/
+	[[nodiscard]]
+	void* allocate(const std::size_t bytes, const std::size_t align)
+	{
+		if (m_current != nullptr) {
+			if (void* const ptr = arena::bump(m_current, m_offset, bytes, align)) {
+				return ptr;
+			}
+			// The blocks after the current one are left from before the reset
+			if ((m_current->next != nullptr) && arena::fits(m_current->next, bytes, align)) {
+				m_current = m_current->next;
+				m_offset = 0;
+				return arena::bump(m_current, m_offset, bytes, align);
+			}
+		}
+
+		const std::size_t size = (std::max)(m_block_size, sizeof(Block) + bytes + align);
+		Block* const block = static_cast<Block*>(::operator new(size));
+		block->size = size - sizeof(Block);
+		if (m_current == nullptr) {
+			block->next = m_first;
+			m_first = block;
+		} else {
+			block->next = m_current->next;
+			m_current->next = block;
+		}
+		m_current = block;
+		m_offset = 0;
+		return arena::bump(m_current, m_offset, bytes, align);
+	}
+
+	/**
+		@brief Releases all allocations in O(1). The blocks are kept for the next allocations
+	*/
+	void reset() noexcept
+	{
+		m_current = m_first;
+		m_offset = 0;
+	}
+
+	/**
+		@brief Checks if @p ptr points into the blocks of the arena
+	*/
+	[[nodiscard]]
+	bool owns(const void* const ptr) const noexcept
+	{
+		const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+		for (const Block* block = m_first; block != nullptr; block = block->next) {
+			const auto begin = reinterpret_cast<std::uintptr_t>(block + 1);
+			if ((address >= begin) && (address < (begin + block->size))) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+		@brief The current arena of the thread or @c nullptr
+	*/
+	[[nodiscard]] static
+	arena* current() noexcept { return arena::current_ref(); }
+
+private:
+	static arena*& current_ref() noexcept
+	{
+		static thread_local arena* current = nullptr;
+		return current;
+	}
+
+	static void* bump(Block* const block, std::size_t& offset, const std::size_t bytes, const std::size_t align) noexcept
+	{
+		const auto begin = reinterpret_cast<std::uintptr_t>(block + 1);
+		const std::uintptr_t aligned = (begin + offset + align - 1) & ~static_cast<std::uintptr_t>(align - 1);
+		if ((aligned + bytes) > (begin + block->size)) {
+			return nullptr;
+		}
+		offset = (aligned + bytes) - begin;
+		return reinterpret_cast<void*>(aligned);
+	}
+
+	static bool fits(const Block* const block, const std::size_t bytes, const std::size_t align) noexcept {
+		return (bytes + align) <= block->size;
+	}
+
+	std::size_t m_block_size;
+	arena* m_previous;
+	Block* m_first = nullptr;
+	Block* m_current = nullptr;
+	std::size_t m_offset = 0;
+};
+
+/**
+	@brief Allocator that allocates from the current aml::arena of the thread
+	@details The arena is taken when the allocator is created, so the dynamic vectors and the results of their operations 
+			 which are created while the arena is alive allocate from it, the deallocation is free.
+			 The results keep the allocator through aml::rebind. Without the current arena the allocator uses @c operator @c new
+	
+	@tparam T The value type
+
+	@code
+	aml::arena frame_arena;
+	for (auto& frame : frames) {
+		using vector_t = aml::Vector<std::vector<float, aml::arena_allocator<float>>, aml::dynamic_extent>;
+		const vector_t velocity = frame.force * dt + frame.velocity;
+		...
+		frame_arena.reset();
+	}
+	@endcode
+*/
+template<class T>
+class arena_allocator
+{
+public:
+
+	using value_type = T;
+	using propagate_on_container_copy_assignment = std::true_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap = std::true_type;
+
+	template<class U>
+	struct rebind {
+		using other = arena_allocator<U>;
+		using type = other;
+	};
+
+	/// Allocates from the current arena of the thread
+	arena_allocator() noexcept
+		: m_arena(aml::arena::current()) {}
+
+	/// Allocates from @p source, or from @c operator @c new if it is @c nullptr
+	explicit arena_allocator(aml::arena* const source) noexcept
+		: m_arena(source) {}
+
+	template<class U>
+	arena_allocator(const arena_allocator<U>& other) noexcept
+		: m_arena(other.source()) {}
+
+	[[nodiscard]]
+	T* allocate(const std::size_t count)
+	{
+		const std::size_t bytes = detail::allocation_bytes<T>(count);
+		if (m_arena != nullptr) {
+			return static_cast<T*>(m_arena->allocate(bytes, alignof(T)));
+		}
+		return static_cast<T*>(::operator new(bytes, std::align_val_t{alignof(T)}));
+	}
+
+	void deallocate(T* const ptr, [[maybe_unused]] const std::size_t count) noexcept
+	{
+		if (m_arena == nullptr) {
+			::operator delete(ptr, std::align_val_t{alignof(T)});
+		}
+	}
+
+	/// The arena of the allocator or @c nullptr
+	[[nodiscard]]
+	aml::arena* source() const noexcept { return m_arena; }
+
+	template<class U>
+	friend bool operator==(const arena_allocator& left, const arena_allocator<U>& right) noexcept { return left.source() == right.source(); }
+	template<class U>
+	friend bool operator!=(const arena_allocator& left, const arena_allocator<U>& right) noexcept { return left.source() != right.source(); }
+
+private:
+	aml::arena* m_arena;
+};
+
+}
@@ -0,0 +1,554 @@
+/** @file */
+#pragma once
+
+#include <AML/Vector.hpp>
+#include <AML/Dispatch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifdef AML_LIBRARY
+	#define AML_LIBRARY_BIT_VECTOR
+#else
+	#error AML library is required
+#endif
+
+#if (defined(__AVX512VPOPCNTDQ__) && defined(__AVX512F__)) || AML_DISPATCH_X86
+	#define AML_HAS_VPOPCNTDQ_KERNELS 1
+	#include <immintrin.h>
+#else
+	#define AML_HAS_VPOPCNTDQ_KERNELS 0
+#endif
+
+#if defined(__POPCNT__) || AML_DISPATCH_X86
+	#define AML_HAS_POPCNT_KERNELS 1
+#else
+	#define AML_HAS_POPCNT_KERNELS 0
+#endif
+
+#if defined(__AVX512VPOPCNTDQ__) && defined(__AVX512F__)
+	#define AML_TARGET_VPOPCNTDQ
+#elif AML_DISPATCH_X86
+	#define AML_TARGET_VPOPCNTDQ __attribute__((target("avx2,avx512f,avx512vpopcntdq")))
+#endif
+
+#if defined(__POPCNT__)
+	#define AML_TARGET_POPCNT
+#elif AML_DISPATCH_X86
+	#define AML_TARGET_POPCNT __attribute__((target("popcnt")))
+#endif
+
+namespace aml
+{
+
+namespace detail
+{
+	inline constexpr std::size_t bit_word_size = 64;
+
+	constexpr
+	std::size_t bit_words_for(const std::size_t bits) noexcept {
+		return (bits + detail::bit_word_size - 1) / detail::bit_word_size;
+	}
+
+	/// Counts the bits with the shifts and the masks, the compilers without the @c popcnt instruction call the library for @c __builtin_popcountll
+	constexpr
+	std::uint64_t popcount_word(std::uint64_t word) noexcept
+	{
+		word = word - ((word >> 1) & 0x5555555555555555u);
+		word = (word & 0x3333333333333333u) + ((word >> 2) & 0x3333333333333333u);
+		word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fu;
+		return (word * 0x0101010101010101u) >> 56;
+	}
+
+	inline
+	std::uint64_t hamming_words_generic(const std::uint64_t* const left, const std::uint64_t* const right, const std::size_t count) noexcept
+	{
+		std::uint64_t out = 0;
+		for (std::size_t i = 0; i < count; ++i) {
+			out += detail::popcount_word(left[i] ^ right[i]);
+		}
+		return out;
+	}
+
+	inline
+	std::uint64_t popcount_words_generic(const std::uint64_t* const words, const std::size_t count) noexcept
+	{
+		std::uint64_t out = 0;
+		for (std::size_t i = 0; i < count; ++i) {
+			out += detail::popcount_word(words[i]);
+		}
+		return out;
+	}
+
+	inline
+	void hamming_scan_generic(const std::uint64_t* const query, const std::uint64_t* const codes, const std::size_t words, const std::size_t count, std::uint32_t* const out) noexcept
+	{
+		for (std::size_t c = 0; c < count; ++c) {
+			out[c] = static_cast<std::uint32_t>(detail::hamming_words_generic(query, codes + c * words, words));
+		}
+	}
+
+#if AML_HAS_POPCNT_KERNELS
+	/// Four independent sums hide the latency of @c popcnt
+	AML_TARGET_POPCNT inline
+	std::uint64_t hamming_words_popcnt(const std::uint64_t* const left, const std::uint64_t* const right, const std::size_t count) noexcept
+	{
+		std::uint64_t acc[4] = {};
+		std::size_t i = 0;
+		for (; (i + 4) <= count; i += 4) {
+			for (std::size_t j = 0; j < 4; ++j) {
+				acc[j] += static_cast<std::uint64_t>(__builtin_popcountll(left[i + j] ^ right[i + j]));
+			}
+		}
+		for (; i < count; ++i) {
+			acc[0] += static_cast<std::uint64_t>(__builtin_popcountll(left[i] ^ right[i]));
+		}
+		return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+	}
+
+	AML_TARGET_POPCNT inline
+	std::uint64_t popcount_words_popcnt(const std::uint64_t* const words, const std::size_t count) noexcept
+	{
+		std::uint64_t acc[4] = {};
+		std::size_t i = 0;
+		for (; (i + 4) <= count; i += 4) {
+			for (std::size_t j = 0; j < 4; ++j) {
+				acc[j] += static_cast<std::uint64_t>(__builtin_popcountll(words[i + j]));
+			}
+		}
+		for (; i < count; ++i) {
+			acc[0] += static_cast<std::uint64_t>(__builtin_popcountll(words[i]));
+		}
+		return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+	}
+
+	AML_TARGET_POPCNT inline
+	void hamming_scan_popcnt(const std::uint64_t* const query, const std::uint64_t* const codes, const std::size_t words, const std::size_t count, std::uint32_t* const out) noexcept
+	{
+		for (std::size_t c = 0; c < count; ++c) {
+			out[c] = static_cast<std::uint32_t>(detail::hamming_words_popcnt(query, codes + c * words, words));
+		}
+	}
+#endif
+
+#if AML_HAS_VPOPCNTDQ_KERNELS
+	/// Counts 8 words at once with @c vpopcntq, the tail is loaded with the mask
+	AML_TARGET_VPOPCNTDQ inline
+	std::uint64_t hamming_words_vpopcntdq(const std::uint64_t* const left, const std::uint64_t* const right, const std::size_t count) noexcept
+	{
+		__m512i acc = _mm512_setzero_si512();
+		std::size_t i = 0;
+		for (; (i + 8) <= count; i += 8) {
+			const __m512i diff = _mm512_xor_si512(_mm512_loadu_si512(left + i), _mm512_loadu_si512(right + i));
+			acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(diff));
+		}
+		if (i < count) {
+			const __mmask8 mask = static_cast<__mmask8>((1u << (count - i)) - 1);
+			const __m512i diff = _mm512_xor_si512(_mm512_maskz_loadu_epi64(mask, left + i), _mm512_maskz_loadu_epi64(mask, right + i));
+			acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(diff));
+		}
+		// Stored and added in the scalar code, the extraction of the halves warns about the undefined upper lanes in GCC
+		alignas(64) std::uint64_t lanes[8];
+		_mm512_store_si512(lanes, acc);
+		std::uint64_t out = 0;
+		for (const std::uint64_t lane : lanes) {
+			out += lane;
+		}
+		return out;
+	}
+
+	AML_TARGET_VPOPCNTDQ inline
+	std::uint64_t popcount_words_vpopcntdq(const std::uint64_t* const words, const std::size_t count) noexcept
+	{
+		__m512i acc = _mm512_setzero_si512();
+		std::size_t i = 0;
+		for (; (i + 8) <= count; i += 8) {
+			acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(_mm512_loadu_si512(words + i)));
+		}
+		if (i < count) {
+			const __mmask8 mask = static_cast<__mmask8>((1u << (count - i)) - 1);
+			acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(_mm512_maskz_loadu_epi64(mask, words + i)));
+		}
+		alignas(64) std::uint64_t lanes[8];
+		_mm512_store_si512(lanes, acc);
+		std::uint64_t out = 0;
+		for (const std::uint64_t lane : lanes) {
+			out += lane;
+		}
+		return out;
+	}
+
+	AML_TARGET_VPOPCNTDQ inline
+	void hamming_scan_vpopcntdq(const std::uint64_t* const query, const std::uint64_t* const codes, const std::size_t words, const std::size_t count, std::uint32_t* const out) noexcept
+	{
+		for (std::size_t c = 0; c < count; ++c) {
+			out[c] = static_cast<std::uint32_t>(detail::hamming_words_vpopcntdq(query, codes + c * words, words));
+		}
+	}
+#endif
+
+	inline
+	bool has_vpopcntdq() noexcept
+	{
+#if defined(__AVX512VPOPCNTDQ__) && defined(__AVX512F__)
+		return true;
+#elif AML_DISPATCH_X86
+		static const bool supported = (aml::active_isa() == aml::cpu_isa::avx512) && __builtin_cpu_supports("avx512vpopcntdq");
+		return supported;
+#else
+		return false;
+#endif
+	}
+
+	/// Every processor with AVX2 has @c popcnt
+	inline
+	bool has_popcnt() noexcept
+	{
+#if defined(__POPCNT__)
+		return true;
+#elif AML_DISPATCH_X86
+		return (aml::active_isa() != aml::cpu_isa::sse2);
+#else
+		return false;
+#endif
+	}
+
+	/**
+		@brief Number of the set bits of the @p count words from @p words
+		@details Uses AVX-512 VPOPCNTDQ or @c popcnt if the build enables them or #AML_CPU_DISPATCH finds them, otherwise the shifts and the masks
+	*/
+	inline
+	std::uint64_t popcount_words(const std::uint64_t* const words, const std::size_t count) noexcept
+	{
+#if AML_HAS_VPOPCNTDQ_KERNELS
+		if (detail::has_vpopcntdq()) {
+			return detail::popcount_words_vpopcntdq(words, count);
+		}
+#endif
+#if AML_HAS_POPCNT_KERNELS
+		if (detail::has_popcnt()) {
+			return detail::popcount_words_popcnt(words, count);
+		}
+#endif
+		return detail::popcount_words_generic(words, count);
+	}
+
+	/**
+		@brief Number of the different bits of the @p count words from @p left and @p right
+		@details Selects the instruction set as detail::popcount_words()
+	*/
+	inline
+	std::uint64_t hamming_words(const std::uint64_t* const left, const std::uint64_t* const right, const std::size_t count) noexcept
+	{
+#if AML_HAS_VPOPCNTDQ_KERNELS
+		if (detail::has_vpopcntdq()) {
+			return detail::hamming_words_vpopcntdq(left, right, count);
+		}
+#endif
+#if AML_HAS_POPCNT_KERNELS
+		if (detail::has_popcnt()) {
+			return detail::hamming_words_popcnt(left, right, count);
+		}
+#endif
+		return detail::hamming_words_generic(left, right, count);
+	}
+
+	/**
+		@brief Hamming distances between the @p query and the @p count codes of @p words words which follow each other from @p codes
+		@details Uses AVX-512 VPOPCNTDQ or @c popcnt if the build enables them or #AML_CPU_DISPATCH finds them, otherwise the shifts and the masks.
+				 The instruction set is selected once for the whole scan
+	*/
+	inline
+	void hamming_scan(const std::uint64_t* const query, const std::uint64_t* const codes, const std::size_t words, const std::size_t count, std::uint32_t* const out) noexcept
+	{
+#if AML_HAS_VPOPCNTDQ_KERNELS
+		if (detail::has_vpopcntdq()) {
+			return detail::hamming_scan_vpopcntdq(query, codes, words, count, out);
+		}
+#endif
+#if AML_HAS_POPCNT_KERNELS
+		if (detail::has_popcnt()) {
+			return detail::hamming_scan_popcnt(query, codes, words, count, out);
+		}
+#endif
+		detail::hamming_scan_generic(query, codes, words, count, out);
+	}
+}
+
+/**
+	@brief Packs the signs of @p count numbers from @p first into the bits of @p out, the bit is set for the positive numbers
+	@details The bit @c i is the bit <tt>i % 64</tt> of the word <tt>i / 64</tt>, the unused bits of the last word are zero.
+			 With SSE2 4 numbers are compared at once and their bits are taken with @c movmskps
+*/
+inline
+void binarize_n(const float* const first, const std::size_t count, std::uint64_t* const out) noexcept
+{
+	const std::size_t full_words = count / detail::bit_word_size;
+	for (std::size_t w = 0; w < full_words; ++w) {
+		const float* const block = first + w * detail::bit_word_size;
+		std::uint64_t word = 0;
+#if AML_SSE2
+		const __m128 zero = _mm_setzero_ps();
+		for (std::size_t j = 0; j < detail::bit_word_size; j += 4) {
+			const int mask = _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(block + j), zero));
+			word |= static_cast<std::uint64_t>(mask) << j;
+		}
+#else
+		for (std::size_t j = 0; j < detail::bit_word_size; ++j) {
+			word |= static_cast<std::uint64_t>(block[j] > 0.f) << j;
+		}
+#endif
+		out[w] = word;
+	}
+
+	if (const std::size_t rest = count % detail::bit_word_size; rest != 0) {
+		const float* const block = first + full_words * detail::bit_word_size;
+		std::uint64_t word = 0;
+		for (std::size_t j = 0; j < rest; ++j) {
+			word |= static_cast<std::uint64_t>(block[j] > 0.f) << j;
+		}
+		out[full_words] = word;
+	}
+}
+
+/**
+	@brief Vector of bits packed into 64-bit words, the binary code of a @c float vector
+	@details Takes 1 bit per element, 32 times less memory than aml::DVector<float>,
+			 so the Hamming distances of the codes (aml::hamming_distance, aml::hamming_scan) filter the candidates before the exact distances.
+			 The unused bits of the last word are always zero
+
+	@see aml::binarize_n(), aml::BitVectorArray
+*/
+class BitVector
+{
+public:
+
+	using word_type	= std::uint64_t;
+	using size_type	= std::size_t;
+
+	BitVector() = default;
+
+	/**
+		@brief Creates the vector of @p initsz zero bits
+	*/
+	explicit BitVector(const aml::size_initializer initsz)
+		: m_words(detail::bit_words_for(initsz.size)), m_size(initsz.size) {}
+
+	/**
+		@brief Binarizes @p vec by the signs, the bit is set for the positive elements
+
+		@see aml::binarize_n()
+	*/
+	explicit BitVector(const aml::DVector<float>& vec)
+		: BitVector(aml::size_initializer(vec.size()))
+	{
+		aml::binarize_n(vec.data(), vec.size(), m_words.data());
+	}
+
+	/**
+		@return Returns the number of the bits
+	*/
+	[[nodiscard]] size_type size() const noexcept { return m_size; }
+	[[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+	[[nodiscard]] size_type word_count() const noexcept { return m_words.size(); }
+	[[nodiscard]] const word_type* data() const noexcept { return m_words.data(); }
+
+	[[nodiscard]]
+	bool test(const size_type index) const noexcept
+	{
+		AML_DEBUG_VERIFY(index < this->size(), "BitVector index out of range | index: %zu", index);
+		return ((m_words[index / detail::bit_word_size] >> (index % detail::bit_word_size)) & 1u) != 0;
+	}
+
+	void set(const size_type index, const bool value = true) noexcept
+	{
+		AML_DEBUG_VERIFY(index < this->size(), "BitVector index out of range | index: %zu", index);
+		const word_type bit = word_type{1} << (index % detail::bit_word_size);
+		word_type& word = m_words[index / detail::bit_word_size];
+		word = value ? (word | bit) : (word & ~bit);
+	}
+
+	/**
+		@return Returns the number of the set bits
+	*/
+	[[nodiscard]]
+	size_type count() const noexcept {
+		return static_cast<size_type>(detail::popcount_words(this->data(), this->word_count()));
+	}
+
+	BitVector& operator&=(const BitVector& other) noexcept { return this->apply(other, [](const word_type l, const word_type r) { return l & r; }); }
+	BitVector& operator|=(const BitVector& other) noexcept { return this->apply(other, [](const word_type l, const word_type r) { return l | r; }); }
+	BitVector& operator^=(const BitVector& other) noexcept { return this->apply(other, [](const word_type l, const word_type r) { return l ^ r; }); }
+
+	/**
+		@brief Inverts all the bits, the unused bits of the last word stay zero
+	*/
+	[[nodiscard]]
+	BitVector operator~() const
+	{
+		BitVector out = *this;
+		for (word_type& word : out.m_words) {
+			word = ~word;
+		}
+		if (const size_type rest = m_size % detail::bit_word_size; rest != 0) {
+			out.m_words.back() &= (word_type{1} << rest) - 1;
+		}
+		return out;
+	}
+
+	[[nodiscard]] friend BitVector operator&(BitVector left, const BitVector& right) noexcept { return left &= right; }
+	[[nodiscard]] friend BitVector operator|(BitVector left, const BitVector& right) noexcept { return left |= right; }
+	[[nodiscard]] friend BitVector operator^(BitVector left, const BitVector& right) noexcept { return left ^= right; }
+
+	[[nodiscard]]
+	friend bool operator==(const BitVector& left, const BitVector& right) noexcept {
+		return (left.m_size == right.m_size) && (left.m_words == right.m_words);
+	}
+#if !AML_CXX20
+	[[nodiscard]]
+	friend bool operator!=(const BitVector& left, const BitVector& right) noexcept {
+		return !(left == right);
+	}
+#endif
+
+private:
+
+	template<class Operation>
+	BitVector& apply(const BitVector& other, Operation&& operation) noexcept
+	{
+		AML_DEBUG_VERIFY(this->size() == other.size(),
+			"BitVector's sizes must be equal | left size: %zu, right size: %zu", this->size(), other.size());
+		for (size_type i = 0; i < m_words.size(); ++i) {
+			m_words[i] = operation(m_words[i], other.m_words[i]);
+		}
+		return *this;
+	}
+
+	std::vector<word_type> m_words;
+	size_type m_size = 0;
+};
+
+/**
+	@brief Binary codes of the same size which follow each other in the single buffer, the database of aml::hamming_scan
+
+	@see aml::BitVector
+*/
+class BitVectorArray
+{
+public:
+
+	using word_type	= aml::BitVector::word_type;
+	using size_type	= std::size_t;
+
+	/**
+		@brief Creates the empty array of the codes of @p bits bits
+	*/
+	explicit BitVectorArray(const size_type bits) noexcept
+		: m_bits(bits), m_code_words(detail::bit_words_for(bits)) {}
+
+	/**
+		@return Returns the number of the codes
+	*/
+	[[nodiscard]] size_type size() const noexcept { return m_size; }
+	[[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+	/// The number of the bits of every code
+	[[nodiscard]] size_type bits() const noexcept { return m_bits; }
+	/// The number of the words of every code
+	[[nodiscard]] size_type code_words() const noexcept { return m_code_words; }
+
+	void reserve(const size_type new_capacity) {
+		m_words.reserve(new_capacity * m_code_words);
+	}
+
+	void clear() noexcept
+	{
+		m_words.clear();
+		m_size = 0;
+	}
+
+	void push_back(const aml::BitVector& code)
+	{
+		AML_DEBUG_VERIFY(code.size() == this->bits(),
+			"BitVectorArray's code size must be equal | code size: %zu, array code size: %zu", code.size(), this->bits());
+		m_words.insert(m_words.end(), code.data(), code.data() + m_code_words);
+		++m_size;
+	}
+
+	/**
+		@brief Binarizes @p vec directly into the array
+
+		@see aml::binarize_n()
+	*/
+	void push_back(const aml::DVector<float>& vec)
+	{
+		AML_DEBUG_VERIFY(vec.size() == this->bits(),
+			"BitVectorArray's code size must be equal | vector size: %zu, array code size: %zu", vec.size(), this->bits());
+		m_words.resize(m_words.size() + m_code_words);
+		aml::binarize_n(vec.data(), vec.size(), m_words.data() + m_size * m_code_words);
+		++m_size;
+	}
+
+	/**
+		@return Pointer to the first word of the code at @p index
+	*/
+	[[nodiscard]]
+	const word_type* code(const size_type index) const noexcept
+	{
+		AML_DEBUG_VERIFY(index < this->size(), "BitVectorArray index out of range | index: %zu", index);
+		return m_words.data() + index * m_code_words;
+	}
+
+	[[nodiscard]] const word_type* data() const noexcept { return m_words.data(); }
+
+private:
+	std::vector<word_type> m_words;
+	size_type m_bits;
+	size_type m_code_words;
+	size_type m_size = 0;
+};
+
+/**
+	@brief Number of the different bits. @f$ popcount(a \oplus b) @f$
+
+	@note The sizes of the vectors must be equal
+*/
+[[nodiscard]] inline
+std::size_t hamming_distance(const aml::BitVector& left, const aml::BitVector& right) noexcept
+{
+	AML_DEBUG_VERIFY(left.size() == right.size(),
+		"BitVector's sizes must be equal | left size: %zu, right size: %zu", left.size(), right.size());
+	return static_cast<std::size_t>(detail::hamming_words(left.data(), right.data(), left.word_count()));
+}
+
+/**
+	@brief Hamming distances between the @p query and every code of @p codes into @p out
+	@details The distances are stored in @c std::uint32_t, so the codes must be shorter than 2^32 bits
+
+	@note The size of the query must be equal to the size of the codes
+*/
+inline
+void hamming_scan(const aml::BitVector& query, const aml::BitVectorArray& codes, std::uint32_t* const out) noexcept
+{
+	AML_DEBUG_VERIFY(query.size() == codes.bits(),
+		"BitVector's sizes must be equal | query size: %zu, code size: %zu", query.size(), codes.bits());
+	detail::hamming_scan(query.data(), codes.data(), codes.code_words(), codes.size(), out);
+}
+
+/**
+	@brief Hamming distances between the @p query and every code of @p codes
+
+	@see aml::hamming_scan(const aml::BitVector&, const aml::BitVectorArray&, std::uint32_t*)
+*/
+[[nodiscard]] inline
+std::vector<std::uint32_t> hamming_scan(const aml::BitVector& query, const aml::BitVectorArray& codes)
+{
+	std::vector<std::uint32_t> out(codes.size());
+	aml::hamming_scan(query, codes, out.data());
+	return out;
+}
+
+}
@@ -0,0 +1,244 @@
+/** @file */
+#pragma once
+
+#include <AML/Vector.hpp>
+#include <AML/Functions.hpp>
+
+#include <cmath>
+#include <type_traits>
+
+#ifdef AML_LIBRARY
+	#define AML_LIBRARY_BLAS
+#else
+	#error AML library is required
+#endif
+
+namespace aml
+{
+
+namespace detail
+{
+	/**
+		@brief @f$ a b + c @f$
+		@details Uses @c std::fma if the target has the fast fused multiply-add instruction (@c FP_FAST_FMA, @c FP_FAST_FMAF),
+				 otherwise the separate multiplication and addition
+	*/
+	template<class T> [[nodiscard]] constexpr
+	T muladd(const T& a, const T& b, const T& c) noexcept
+	{
+#ifdef FP_FAST_FMAF
+		if constexpr (std::is_same_v<T, float>) {
+			if (!AML_IS_CONSTANT_EVALUATED()) {
+				return std::fma(a, b, c);
+			}
+		}
+#endif
+#ifdef FP_FAST_FMA
+		if constexpr (std::is_same_v<T, double>) {
+			if (!AML_IS_CONSTANT_EVALUATED()) {
+				return std::fma(a, b, c);
+			}
+		}
+#endif
+		return static_cast<T>((a * b) + c);
+	}
+}
+
+/**
+	@brief Scaled vector addition. @f$ \vec{y} = \alpha \vec{x} + \vec{y} @f$
+
+	@param y Static vector, dynamic vector or vector view with the same size as @p x. Must not partially overlap with @p x
+*/
+template<class Alpha, class X, class Y,
+	std::enable_if_t<!detail::is_vector_operand<Alpha> && detail::is_vector_operand<X> && detail::is_vector_operand<Y>, int> = 0
+> constexpr
+void axpy(const Alpha& alpha, const X& x, Y&& y) noexcept
+{
+	using value_type = typename aml::remove_cvref<Y>::value_type;
+
+	detail::verify_vector_size(y, x);
+	const auto a = static_cast<value_type>(alpha);
+	const auto& xs = detail::lower_operand(x);
+	const auto& ys = detail::lower_operand(y);
+	detail::write_vector(y, [&](const auto i) {
+		return detail::muladd(a, static_cast<value_type>(xs[i]), static_cast<value_type>(ys[i]));
+	}, xs, ys);
+}
+
+/**
+	@brief Scaled vector addition with the scaled output. @f$ \vec{y} = \alpha \vec{x} + \beta \vec{y} @f$
+
+	@see aml::axpy()
+*/
+template<class Alpha, class X, class Beta, class Y,
+	std::enable_if_t<!detail::is_vector_operand<Alpha> && detail::is_vector_operand<X> && !detail::is_vector_operand<Beta> && detail::is_vector_operand<Y>, int> = 0
+> constexpr
+void axpby(const Alpha& alpha, const X& x, const Beta& beta, Y&& y) noexcept
+{
+	using value_type = typename aml::remove_cvref<Y>::value_type;
+
+	detail::verify_vector_size(y, x);
+	const auto a = static_cast<value_type>(alpha);
+	const auto b = static_cast<value_type>(beta);
+	const auto& xs = detail::lower_operand(x);
+	const auto& ys = detail::lower_operand(y);
+	detail::write_vector(y, [&](const auto i) {
+		return detail::muladd(a, static_cast<value_type>(xs[i]), static_cast<value_type>(b * ys[i]));
+	}, xs, ys);
+}
+
+/**
+	@brief Scales the vector in place. @f$ \vec{x} = \alpha \vec{x} @f$
+*/
+template<class Alpha, class X,
+	std::enable_if_t<!detail::is_vector_operand<Alpha> && detail::is_vector_operand<X>, int> = 0
+> constexpr
+void scal(const Alpha& alpha, X&& x) noexcept
+{
+	const auto a = static_cast<typename aml::remove_cvref<X>::value_type>(alpha);
+	const auto& xs = detail::lower_operand(x);
+	detail::write_vector(x, [&](const auto i) { return a * xs[i]; }, xs);
+}
+
+/**
+	@brief Hadamard (element-wise) product of the vectors. @f$ \vec{out}_i = \vec{x}_i \vec{y}_i @f$
+
+	@param out Static vector, dynamic vector or vector view with the same size as the operands.
+			   Can be the same vector as one of the operands, but must not partially overlap with them
+*/
+template<class Out, class X, class Y,
+	std::enable_if_t<detail::is_vector_operand<Out> && detail::is_vector_operand<X> && detail::is_vector_operand<Y>, int> = 0
+> constexpr
+void hadamard(Out&& out, const X& x, const Y& y) noexcept
+{
+	detail::verify_vector_size(out, x);
+	detail::verify_vector_size(x, y);
+	const auto& xs = detail::lower_operand(x);
+	const auto& ys = detail::lower_operand(y);
+	detail::write_vector(out, [&](const auto i) { return xs[i] * ys[i]; }, xs, ys);
+}
+
+/**
+	@brief Hadamard product added to the vector. @f$ \vec{out}_i = \vec{x}_i \vec{y}_i + \vec{z}_i @f$
+	@details Fused if the target has the fast fused multiply-add instruction
+
+	@see aml::hadamard()
+*/
+template<class Out, class X, class Y, class Z,
+	std::enable_if_t<detail::is_vector_operand<Out> && detail::is_vector_operand<X> && detail::is_vector_operand<Y> && detail::is_vector_operand<Z>, int> = 0
+> constexpr
+void hadamard_add(Out&& out, const X& x, const Y& y, const Z& z) noexcept
+{
+	using value_type = typename aml::remove_cvref<Out>::value_type;
+
+	detail::verify_vector_size(out, x);
+	detail::verify_vector_size(x, y);
+	detail::verify_vector_size(y, z);
+	const auto& xs = detail::lower_operand(x);
+	const auto& ys = detail::lower_operand(y);
+	const auto& zs = detail::lower_operand(z);
+	detail::write_vector(out, [&](const auto i) {
+		return detail::muladd(static_cast<value_type>(xs[i]), static_cast<value_type>(ys[i]), static_cast<value_type>(zs[i]));
+	}, xs, ys, zs);
+}
+
+/**
+	@brief Euclidean norm of the vector. @f$ || \vec{x} ||_2 @f$
+	@details Same as aml::dist()
+
+	@note Unlike the reference BLAS, the sum of the squares is not rescaled, so it can overflow for the elements greater than the square root of the maximum value
+*/
+template<class OutType = selectable_unused, class X,
+	std::enable_if_t<detail::is_vector_operand<X>, int> = 0
+> [[nodiscard]] constexpr
+auto nrm2(const X& x) noexcept {
+	return aml::dist<OutType>(x);
+}
+
+/**
+	@brief Sum of the absolute values of the elements. @f$ \sum_{i=0}^{n} |\vec{x}_i| @f$
+	@details The sum uses #AML_REDUCTION_LANES independent accumulators
+*/
+template<class OutType = selectable_unused, class X,
+	std::enable_if_t<detail::is_vector_operand<X>, int> = 0
+> [[nodiscard]] constexpr
+auto asum(const X& x) noexcept
+{
+	using result_t = aml::remove_cvref<decltype(aml::abs(x[0]))>;
+
+	return aml::selectable_convert<OutType>(detail::reduce_vector<result_t>([](const auto& elem) {
+		return aml::abs(elem);
+	}, x, x));
+}
+
+/**
+	@brief Index of the first element with the largest absolute value
+	@details The maximum is searched in #AML_REDUCTION_LANES independent lanes
+
+	@return Zero-based index. Zero for the empty vector
+*/
+template<class X,
+	std::enable_if_t<detail::is_vector_operand<X>, int> = 0
+> [[nodiscard]] constexpr
+Vectorsize iamax(const X& x) noexcept
+{
+	const auto& xs = detail::lower_operand(x);
+	using abs_t = aml::remove_cvref<decltype(aml::abs(xs[0]))>;
+
+	constexpr Vectorsize lanes = AML_REDUCTION_LANES;
+	const Vectorsize size = x.size();
+	if (size == 0) {
+		return 0;
+	}
+
+	if constexpr (std::is_arithmetic_v<abs_t>) {
+		if (size >= lanes) {
+			abs_t best[lanes] = {};
+			Vectorsize best_index[lanes] = {};
+			for (Vectorsize j = 0; j < lanes; ++j) {
+				best[j] = aml::abs(xs[j]);
+				best_index[j] = j;
+			}
+
+			Vectorsize i = lanes;
+			for (; (i + lanes) <= size; i += lanes) {
+				for (Vectorsize j = 0; j < lanes; ++j) {
+					const abs_t elem = aml::abs(xs[i + j]);
+					if (elem > best[j]) {
+						best[j] = elem;
+						best_index[j] = i + j;
+					}
+				}
+			}
+			const Vectorsize remainder = size - i;
+			for (Vectorsize j = 0; j < remainder; ++j) {
+				const abs_t elem = aml::abs(xs[i + j]);
+				if (elem > best[j]) {
+					best[j] = elem;
+					best_index[j] = i + j;
+				}
+			}
+
+			Vectorsize out = 0;
+			for (Vectorsize j = 1; j < lanes; ++j) {
+				if ((best[j] > best[out]) || ((best[j] == best[out]) && (best_index[j] < best_index[out]))) {
+					out = j;
+				}
+			}
+			return best_index[out];
+		}
+	}
+
+	Vectorsize out = 0;
+	auto best = aml::abs(xs[0]);
+	for (Vectorsize i = 1; i < size; ++i) {
+		const auto elem = aml::abs(xs[i]);
+		if (elem > best) {
+			best = elem;
+			out = i;
+		}
+	}
+	return out;
+}
+
+}
@@ -2,10 +2,10 @@
 
 #include <AML/Tools.hpp>
 #include <functional>
-
-#if AML_CXX20
+#include <initializer_list>
+#include <iterator>
 #include <memory>
-#endif
+#include <new>
 
 namespace aml
 {
@@ -159,6 +159,295 @@ bool operator!=(
 }
 #endif
 
+/**
+	@brief Resizable contiguous container which stores up to @p InlineN elements inside the object
+	@details Allocates on the heap only when the size exceeds @p InlineN, so
+			 <tt>aml::Vector<aml::small_vector<T, N>, aml::dynamic_extent></tt> has no heap access for the small sizes.
+			 The iterators are pointers, the operations with such vectors use the contiguous paths.
+			 @n
+			 Moving the vector with the inline elements moves the elements one by one and invalidates the iterators
+
+	@tparam T Type of the elements
+	@tparam InlineN Number of the elements stored inside the object
+*/
+template<class T, std::size_t InlineN>
+class small_vector
+{
+public:
+
+	static constexpr auto inline_capacity = InlineN;
+
+	using value_type = T;
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = value_type&;
+	using const_reference = const value_type&;
+	using pointer = value_type*;
+	using const_pointer = const value_type*;
+	using iterator = pointer;
+	using const_iterator = const_pointer;
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+	template<class U>
+	struct rebind {
+		using type = aml::small_vector<U, InlineN>;
+	};
+
+	small_vector() noexcept
+		: m_data(inline_data())
+		, m_size(0)
+		, m_capacity(InlineN) {}
+
+	explicit small_vector(const size_type count)
+		: small_vector() {
+		this->resize(count);
+	}
+
+	small_vector(const size_type count, const value_type& value)
+		: small_vector() {
+		this->resize(count, value);
+	}
+
+	template<class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+	small_vector(InputIt first, InputIt last)
+		: small_vector() {
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>) {
+			this->reserve(static_cast<size_type>(std::distance(first, last)));
+			m_size = static_cast<size_type>(std::uninitialized_copy(first, last, m_data) - m_data);
+		} else {
+			for (; first != last; ++first) {
+				this->emplace_back(*first);
+			}
+		}
+	}
+
+	small_vector(const std::initializer_list<value_type> list)
+		: small_vector(list.begin(), list.end()) {}
+
+	small_vector(const small_vector& other)
+		: small_vector(other.begin(), other.end()) {}
+
+	small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<value_type>)
+		: small_vector() {
+		this->steal(std::move(other));
+	}
+
+	small_vector& operator=(const small_vector& other)
+	{
+		if (this != &other) {
+			this->clear();
+			this->reserve(other.size());
+			m_size = static_cast<size_type>(std::uninitialized_copy(other.begin(), other.end(), m_data) - m_data);
+		}
+		return *this;
+	}
+
+	small_vector& operator=(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<value_type>)
+	{
+		if (this != &other) {
+			this->clear();
+			this->release();
+			this->steal(std::move(other));
+		}
+		return *this;
+	}
+
+	~small_vector() noexcept
+	{
+		this->clear();
+		this->release();
+	}
+
+	[[nodiscard]] size_type size() const noexcept { return m_size; }
+	[[nodiscard]] size_type capacity() const noexcept { return m_capacity; }
+	[[nodiscard]] bool empty() const noexcept { return (m_size == 0); }
+
+	/**
+		@brief Checks if the elements are stored inside the object
+	*/
+	[[nodiscard]] bool is_inline() const noexcept { return (m_data == inline_data()); }
+
+	[[nodiscard]] pointer data() noexcept { return m_data; }
+	[[nodiscard]] const_pointer data() const noexcept { return m_data; }
+
+	iterator begin() noexcept { return m_data; }
+	const_iterator begin() const noexcept { return m_data; }
+	const_iterator cbegin() const noexcept { return m_data; }
+
+	iterator end() noexcept { return m_data + m_size; }
+	const_iterator end() const noexcept { return m_data + m_size; }
+	const_iterator cend() const noexcept { return m_data + m_size; }
+
+	reverse_iterator rbegin() noexcept { return reverse_iterator(this->end()); }
+	const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(this->end()); }
+	const_reverse_iterator crbegin() const noexcept { return this->rbegin(); }
+
+	reverse_iterator rend() noexcept { return reverse_iterator(this->begin()); }
+	const_reverse_iterator rend() const noexcept { return const_reverse_iterator(this->begin()); }
+	const_reverse_iterator crend() const noexcept { return this->rend(); }
+
+	reference operator[](const size_type index) noexcept {
+		AML_DEBUG_VERIFY(index < m_size, "Out of range");
+		return m_data[index];
+	}
+	const_reference operator[](const size_type index) const noexcept {
+		AML_DEBUG_VERIFY(index < m_size, "Out of range");
+		return m_data[index];
+	}
+
+	reference front() noexcept { return (*this)[0]; }
+	const_reference front() const noexcept { return (*this)[0]; }
+	reference back() noexcept { return (*this)[m_size - 1]; }
+	const_reference back() const noexcept { return (*this)[m_size - 1]; }
+
+	void reserve(const size_type new_capacity)
+	{
+		if (new_capacity <= m_capacity) {
+			return;
+		}
+		this->grow(new_capacity, [](pointer) { return size_type{0}; });
+	}
+
+	/**
+		@brief Changes the size, the new elements are value-initialized
+	*/
+	void resize(const size_type new_size)
+	{
+		if (new_size > m_size) {
+			this->reserve(new_size);
+			std::uninitialized_value_construct(m_data + m_size, m_data + new_size);
+		} else {
+			std::destroy(m_data + new_size, m_data + m_size);
+		}
+		m_size = new_size;
+	}
+
+	void resize(const size_type new_size, const value_type& value)
+	{
+		if (new_size > m_capacity) {
+			// The value can be an element of this vector, so it is copied before the elements are moved
+			this->grow(new_size, [&](const pointer first) {
+				std::uninitialized_fill(first, first + (new_size - m_size), value);
+				return new_size - m_size;
+			});
+		} else if (new_size > m_size) {
+			std::uninitialized_fill(m_data + m_size, m_data + new_size, value);
+		} else {
+			std::destroy(m_data + new_size, m_data + m_size);
+		}
+		m_size = new_size;
+	}
+
+	template<class... Args>
+	reference emplace_back(Args&&... args)
+	{
+		if (m_size == m_capacity) {
+			// The arguments can refer to the elements of this vector, so the new element is constructed before the elements are moved
+			this->grow((m_capacity == 0) ? 1 : (m_capacity * 2), [&](const pointer pos) {
+				::new (static_cast<void*>(pos)) value_type(std::forward<Args>(args)...);
+				return size_type{1};
+			});
+		} else {
+			::new (static_cast<void*>(m_data + m_size)) value_type(std::forward<Args>(args)...);
+		}
+		++m_size;
+		return m_data[m_size - 1];
+	}
+
+	void push_back(const value_type& value) { this->emplace_back(value); }
+	void push_back(value_type&& value) { this->emplace_back(std::move(value)); }
+
+	void pop_back() noexcept
+	{
+		AML_DEBUG_VERIFY(m_size > 0, "Minimum limit is used");
+		--m_size;
+		std::destroy_at(m_data + m_size);
+	}
+
+	void clear() noexcept
+	{
+		std::destroy(m_data, m_data + m_size);
+		m_size = 0;
+	}
+
+private:
+
+	pointer inline_data() noexcept { return std::launder(reinterpret_cast<pointer>(m_inline)); }
+	const_pointer inline_data() const noexcept { return std::launder(reinterpret_cast<const_pointer>(m_inline)); }
+
+	// Moves the elements into the new heap storage. construct() first builds the elements after them in the new storage
+	// and returns their number, the size does not count them
+	template<class Construct>
+	void grow(const size_type new_capacity, Construct&& construct)
+	{
+		pointer new_data = std::allocator<value_type>().allocate(new_capacity);
+		size_type constructed = 0;
+		try {
+			constructed = construct(new_data + m_size);
+			if constexpr (std::is_nothrow_move_constructible_v<value_type> || !std::is_copy_constructible_v<value_type>) {
+				std::uninitialized_move(m_data, m_data + m_size, new_data);
+			} else {
+				std::uninitialized_copy(m_data, m_data + m_size, new_data);
+			}
+		} catch (...) {
+			std::destroy(new_data + m_size, new_data + m_size + constructed);
+			std::allocator<value_type>().deallocate(new_data, new_capacity);
+			throw;
+		}
+		std::destroy(m_data, m_data + m_size);
+		this->release();
+		m_data = new_data;
+		m_capacity = new_capacity;
+	}
+
+	// Frees the heap storage, the elements must be already destroyed
+	void release() noexcept
+	{
+		if (!this->is_inline()) {
+			std::allocator<value_type>().deallocate(m_data, m_capacity);
+			m_data = inline_data();
+			m_capacity = InlineN;
+		}
+	}
+
+	// Takes the elements of the other vector, this vector must be empty and inline
+	void steal(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<value_type>)
+	{
+		if (other.is_inline()) {
+			std::uninitialized_move(other.m_data, other.m_data + other.m_size, m_data);
+			m_size = other.m_size;
+			other.clear();
+		} else {
+			m_data = std::exchange(other.m_data, other.inline_data());
+			m_size = std::exchange(other.m_size, 0);
+			m_capacity = std::exchange(other.m_capacity, InlineN);
+		}
+	}
+
+	pointer m_data;
+	size_type m_size;
+	size_type m_capacity;
+	alignas(value_type) unsigned char m_inline[(InlineN == 0 ? 1 : InlineN) * sizeof(value_type)];
+};
+
+template<class Left, std::size_t LeftN, class Right, std::size_t RightN> [[nodiscard]]
+bool operator==(const aml::small_vector<Left, LeftN>& left, const aml::small_vector<Right, RightN>& right) noexcept
+{
+	if (left.size() != right.size()) return false;
+
+	for (std::size_t i = 0; i < left.size(); ++i) {
+		if (!aml::equal(left[i], right[i])) return false;
+	}
+	return true;
+}
+#if !AML_CXX20
+template<class Left, std::size_t LeftN, class Right, std::size_t RightN> [[nodiscard]]
+bool operator!=(const aml::small_vector<Left, LeftN>& left, const aml::small_vector<Right, RightN>& right) noexcept {
+	return !(left == right);
+}
+#endif
+
 template<class T, std::size_t Size>
 class fixed_valarray : private std::array<T, Size> {
 private:
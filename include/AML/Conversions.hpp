@@ -0,0 +1,363 @@
+/** @file */
+#pragma once
+
+#include <AML/Tools.hpp>
+#include <AML/Dispatch.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if AML_SSE2
+	#include <emmintrin.h>
+#endif
+
+#ifdef AML_LIBRARY
+	#define AML_LIBRARY_CONVERSIONS
+#else
+	#error AML library is required
+#endif
+
+#if defined(__AVX2__) || AML_DISPATCH_X86
+	#define AML_HAS_AVX2_CONVERSION_KERNELS 1
+	#include <immintrin.h>
+#else
+	#define AML_HAS_AVX2_CONVERSION_KERNELS 0
+#endif
+
+#if defined(__AVX2__)
+	#define AML_TARGET_CONVERSIONS_AVX2
+#elif AML_DISPATCH_X86
+	#define AML_TARGET_CONVERSIONS_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace aml
+{
+
+/**
+	@brief Rounding of the conversions from the floating point numbers to the integers
+
+	@see aml::convert_n()
+*/
+enum class rounding
+{
+	truncate,		///< Toward zero, like @c static_cast
+	nearest_even,	///< To the nearest, the ties to even
+	floor,			///< Toward negative infinity
+	ceil			///< Toward positive infinity
+};
+
+namespace detail
+{
+	/**
+		@brief Rounds @p value to the integral value without the conversion to the integer, so any value can be rounded
+		@details At runtime the rounding functions of @c <cmath> are used, aml::rounding::nearest_even follows the rounding mode
+				 of the floating point environment like the SIMD kernels.
+				 In the constant evaluation adding and subtracting @f$ 2^{digits-1} @f$ rounds the numbers which are less than it to the nearest even,
+				 the larger numbers, the infinities and NaNs are integral already and returned as is.
+				 The nearest value is corrected by one for the other modes.
+				 The trick is not used at runtime because @c -ffast-math folds the addition and the subtraction away
+	*/
+	template<aml::rounding Mode, class T> [[nodiscard]] constexpr
+	T round_integral(const T value) noexcept
+	{
+		static_assert(std::is_floating_point_v<T>, "Only the floating point numbers are rounded");
+		if (!AML_IS_CONSTANT_EVALUATED()) {
+			if constexpr (Mode == aml::rounding::nearest_even) {
+				return std::nearbyint(value);
+			} else if constexpr (Mode == aml::rounding::floor) {
+				return std::floor(value);
+			} else if constexpr (Mode == aml::rounding::ceil) {
+				return std::ceil(value);
+			} else {
+				return std::trunc(value);
+			}
+		}
+
+		constexpr T limit = static_cast<T>(std::uint64_t{1} << (std::numeric_limits<T>::digits - 1));
+
+		const T magnitude = (value < T(0)) ? -value : value;
+		if (!(magnitude < limit)) {
+			return value;
+		}
+		const T nearest = (value < T(0)) ? ((value - limit) + limit) : ((value + limit) - limit);
+
+		if constexpr (Mode == aml::rounding::nearest_even) {
+			return nearest;
+		} else if constexpr (Mode == aml::rounding::floor) {
+			return (nearest > value) ? (nearest - T(1)) : nearest;
+		} else if constexpr (Mode == aml::rounding::ceil) {
+			return (nearest < value) ? (nearest + T(1)) : nearest;
+		} else {
+			const T nearest_magnitude = (nearest < T(0)) ? -nearest : nearest;
+			return (nearest_magnitude > magnitude) ? (nearest - ((value < T(0)) ? T(-1) : T(1))) : nearest;
+		}
+	}
+
+	/**
+		@brief Rounds @p value by the @p Mode and saturates it to the range of @p To, NaN gives zero
+	*/
+	template<class To, aml::rounding Mode, class From> [[nodiscard]] constexpr
+	To round_saturate(const From value) noexcept
+	{
+		if (value != value) {
+			return To(0);
+		}
+		const From rounded = detail::round_integral<Mode>(value);
+		// The maximum can be rounded up to the power of two in From, then the conversion of the numbers below it does not overflow
+		if (rounded <= static_cast<From>((std::numeric_limits<To>::min)())) {
+			return (std::numeric_limits<To>::min)();
+		}
+		if (rounded >= static_cast<From>((std::numeric_limits<To>::max)())) {
+			return (std::numeric_limits<To>::max)();
+		}
+		return static_cast<To>(rounded);
+	}
+
+	/// Checks if the rounding conversion from @p From to @p To has the SSE2 kernel
+	template<class From, class To>
+	inline constexpr bool has_simd_rounding = AML_SSE2 && (std::is_same_v<From, float> || std::is_same_v<From, double>) &&
+		(std::is_same_v<To, std::int32_t> || std::is_same_v<To, std::int16_t> || std::is_same_v<To, std::uint8_t>);
+
+#if AML_SSE2
+	/// @c cvtps2dq rounds by the rounding mode of MXCSR, which is the nearest even unless the program changes it
+	template<aml::rounding Mode> /** @cond */ AML_FORCEINLINE /** @endcond */
+	__m128i round_ps_epi32(const __m128 value) noexcept
+	{
+		if constexpr (Mode == aml::rounding::truncate) {
+			return _mm_cvttps_epi32(value);
+		} else {
+			const __m128i nearest = _mm_cvtps_epi32(value);
+			if constexpr (Mode == aml::rounding::floor) {
+				// The all-ones mask is -1
+				return _mm_add_epi32(nearest, _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(nearest), value)));
+			} else if constexpr (Mode == aml::rounding::ceil) {
+				return _mm_sub_epi32(nearest, _mm_castps_si128(_mm_cmplt_ps(_mm_cvtepi32_ps(nearest), value)));
+			} else {
+				return nearest;
+			}
+		}
+	}
+
+	/// The results are in the lower two lanes
+	template<aml::rounding Mode> /** @cond */ AML_FORCEINLINE /** @endcond */
+	__m128i round_pd_epi32(const __m128d value) noexcept
+	{
+		if constexpr (Mode == aml::rounding::truncate) {
+			return _mm_cvttpd_epi32(value);
+		} else {
+			const __m128i nearest = _mm_cvtpd_epi32(value);
+			if constexpr (Mode == aml::rounding::floor) {
+				const __m128d mask = _mm_cmpgt_pd(_mm_cvtepi32_pd(nearest), value);
+				return _mm_add_epi32(nearest, _mm_shuffle_epi32(_mm_castpd_si128(mask), _MM_SHUFFLE(3, 3, 2, 0)));
+			} else if constexpr (Mode == aml::rounding::ceil) {
+				const __m128d mask = _mm_cmplt_pd(_mm_cvtepi32_pd(nearest), value);
+				return _mm_sub_epi32(nearest, _mm_shuffle_epi32(_mm_castpd_si128(mask), _MM_SHUFFLE(3, 3, 2, 0)));
+			} else {
+				return nearest;
+			}
+		}
+	}
+
+	/**
+		@brief Rounds 4 numbers from @p first into the @c std::int32_t lanes saturated to its range, NaN gives zero
+		@details The conversion gives the minimum of @c std::int32_t for the numbers out of the range and NaN,
+				 the lanes of the large positive numbers are inverted to the maximum and the lanes of NaN are cleared.
+				 The packing of the lanes into the narrower integers saturates them further
+	*/
+	template<aml::rounding Mode, class From> /** @cond */ AML_FORCEINLINE /** @endcond */
+	__m128i round_lanes(const From* const first) noexcept
+	{
+		constexpr From min = static_cast<From>((std::numeric_limits<std::int32_t>::min)());
+		// The maximum of std::int32_t is not a float, the numbers from 2^31 overflow
+		constexpr From overflow = -min;
+
+		if constexpr (std::is_same_v<From, float>) {
+			const __m128 value = _mm_loadu_ps(first);
+			__m128i out;
+			if constexpr (Mode == aml::rounding::floor || Mode == aml::rounding::ceil) {
+				// The correction by one must not wrap the minimum
+				out = detail::round_ps_epi32<Mode>(_mm_max_ps(value, _mm_set1_ps(min)));
+				const __m128 overflows = _mm_cmpge_ps(value, _mm_set1_ps(overflow));
+				out = _mm_or_si128(_mm_andnot_si128(_mm_castps_si128(overflows), out), _mm_srli_epi32(_mm_castps_si128(overflows), 1));
+			} else {
+				out = _mm_xor_si128(detail::round_ps_epi32<Mode>(value), _mm_castps_si128(_mm_cmpge_ps(value, _mm_set1_ps(overflow))));
+			}
+			return _mm_and_si128(out, _mm_castps_si128(_mm_cmpord_ps(value, value)));
+		} else {
+			constexpr From max = static_cast<From>((std::numeric_limits<std::int32_t>::max)());
+			const __m128d value0 = _mm_loadu_pd(first);
+			const __m128d value1 = _mm_loadu_pd(first + 2);
+			// The clamping gives the minimum for NaN, the mask clears it
+			const __m128d clamped0 = _mm_and_pd(_mm_min_pd(_mm_max_pd(value0, _mm_set1_pd(min)), _mm_set1_pd(max)), _mm_cmpord_pd(value0, value0));
+			const __m128d clamped1 = _mm_and_pd(_mm_min_pd(_mm_max_pd(value1, _mm_set1_pd(min)), _mm_set1_pd(max)), _mm_cmpord_pd(value1, value1));
+			return _mm_unpacklo_epi64(detail::round_pd_epi32<Mode>(clamped0), detail::round_pd_epi32<Mode>(clamped1));
+		}
+	}
+#endif
+
+#if AML_HAS_AVX2_CONVERSION_KERNELS
+	/// The nearest rounding uses the rounding mode of MXCSR, the same as @c cvtps2dq of the SSE2 kernels
+	template<aml::rounding Mode>
+	inline constexpr int avx_rounding = ((Mode == aml::rounding::floor) ? _MM_FROUND_TO_NEG_INF 
+									  : ((Mode == aml::rounding::ceil) ? _MM_FROUND_TO_POS_INF : _MM_FROUND_CUR_DIRECTION)) | _MM_FROUND_NO_EXC;
+
+	/// Rounds to the integral values, the truncation is left to @c vcvttps2dq
+	template<aml::rounding Mode> AML_TARGET_CONVERSIONS_AVX2 inline
+	__m256 round_integral_avx2(const __m256 value) noexcept
+	{
+		if constexpr (Mode == aml::rounding::truncate) {
+			return value;
+		} else {
+			return _mm256_round_ps(value, detail::avx_rounding<Mode>);
+		}
+	}
+
+	template<aml::rounding Mode> AML_TARGET_CONVERSIONS_AVX2 inline
+	__m256d round_integral_avx2(const __m256d value) noexcept
+	{
+		if constexpr (Mode == aml::rounding::truncate) {
+			return value;
+		} else {
+			return _mm256_round_pd(value, detail::avx_rounding<Mode>);
+		}
+	}
+
+	/// The same as detail::round_lanes() for 8 numbers
+	template<aml::rounding Mode, class From> AML_TARGET_CONVERSIONS_AVX2 inline
+	__m256i round_lanes_avx2(const From* const first) noexcept
+	{
+		constexpr From min = static_cast<From>((std::numeric_limits<std::int32_t>::min)());
+
+		if constexpr (std::is_same_v<From, float>) {
+			const __m256 value = _mm256_loadu_ps(first);
+			const __m256i out = _mm256_xor_si256(_mm256_cvttps_epi32(detail::round_integral_avx2<Mode>(value)), 
+				_mm256_castps_si256(_mm256_cmp_ps(value, _mm256_set1_ps(-min), _CMP_GE_OQ)));
+			return _mm256_and_si256(out, _mm256_castps_si256(_mm256_cmp_ps(value, value, _CMP_ORD_Q)));
+		} else {
+			constexpr From max = static_cast<From>((std::numeric_limits<std::int32_t>::max)());
+			const auto convert = [](const __m256d value) AML_TARGET_CONVERSIONS_AVX2 {
+				const __m256d clamped = _mm256_min_pd(_mm256_max_pd(value, _mm256_set1_pd(min)), _mm256_set1_pd(max));
+				return _mm256_cvttpd_epi32(_mm256_and_pd(detail::round_integral_avx2<Mode>(clamped), _mm256_cmp_pd(value, value, _CMP_ORD_Q)));
+			};
+			return _mm256_inserti128_si256(_mm256_castsi128_si256(convert(_mm256_loadu_pd(first))), convert(_mm256_loadu_pd(first + 4)), 1);
+		}
+	}
+
+	/**
+		@brief Converts the blocks of 32 numbers, returns the number of the converted numbers
+		@details The packing instructions of AVX2 pack the 128-bit halves separately, the permutations restore the order
+	*/
+	template<class To, aml::rounding Mode, class From> AML_TARGET_CONVERSIONS_AVX2 inline
+	std::size_t convert_rounded_avx2(const From* const first, const std::size_t count, To* const out) noexcept
+	{
+		std::size_t i = 0;
+		for (; (i + 32) <= count; i += 32) {
+			const __m256i lanes0 = detail::round_lanes_avx2<Mode>(first + i);
+			const __m256i lanes1 = detail::round_lanes_avx2<Mode>(first + i + 8);
+			const __m256i lanes2 = detail::round_lanes_avx2<Mode>(first + i + 16);
+			const __m256i lanes3 = detail::round_lanes_avx2<Mode>(first + i + 24);
+			if constexpr (std::is_same_v<To, std::int32_t>) {
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), lanes0);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i + 8), lanes1);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i + 16), lanes2);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i + 24), lanes3);
+			} else if constexpr (std::is_same_v<To, std::int16_t>) {
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_permute4x64_epi64(_mm256_packs_epi32(lanes0, lanes1), _MM_SHUFFLE(3, 1, 2, 0)));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i + 16), _mm256_permute4x64_epi64(_mm256_packs_epi32(lanes2, lanes3), _MM_SHUFFLE(3, 1, 2, 0)));
+			} else {
+				const __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(lanes0, lanes1), _mm256_packs_epi32(lanes2, lanes3));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7)));
+			}
+		}
+		return i;
+	}
+#endif
+
+	inline
+	bool has_avx2_conversions() noexcept
+	{
+#if defined(__AVX2__)
+		return true;
+#elif AML_DISPATCH_X86
+		return (aml::active_isa() != aml::cpu_isa::sse2);
+#else
+		return false;
+#endif
+	}
+
+	template<class To, aml::rounding Mode, class From>
+	void convert_rounded(const From* const first, const std::size_t count, To* const out) noexcept
+	{
+		std::size_t i = 0;
+#if AML_HAS_AVX2_CONVERSION_KERNELS
+		if constexpr (detail::has_simd_rounding<From, To>) {
+			if (detail::has_avx2_conversions()) {
+				i = detail::convert_rounded_avx2<To, Mode>(first, count, out);
+			}
+		}
+#endif
+#if AML_SSE2
+		if constexpr (detail::has_simd_rounding<From, To>) {
+			for (; (i + 16) <= count; i += 16) {
+				const __m128i lanes0 = detail::round_lanes<Mode>(first + i);
+				const __m128i lanes1 = detail::round_lanes<Mode>(first + i + 4);
+				const __m128i lanes2 = detail::round_lanes<Mode>(first + i + 8);
+				const __m128i lanes3 = detail::round_lanes<Mode>(first + i + 12);
+				if constexpr (std::is_same_v<To, std::int32_t>) {
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), lanes0);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 4), lanes1);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8), lanes2);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 12), lanes3);
+				} else if constexpr (std::is_same_v<To, std::int16_t>) {
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi32(lanes0, lanes1));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8), _mm_packs_epi32(lanes2, lanes3));
+				} else {
+					const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(lanes0, lanes1), _mm_packs_epi32(lanes2, lanes3));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), packed);
+				}
+			}
+		}
+#endif
+		for (; i < count; ++i) {
+			out[i] = detail::round_saturate<To, Mode>(first[i]);
+		}
+	}
+
+	template<class T>
+	inline constexpr bool is_convertible_number = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+}
+
+/**
+	@brief Converts @p count numbers from @p first into @p out
+	@details The conversions from the floating point numbers to the integers round by @p mode and saturate to the range of @p To, NaN gives zero.
+			 The conversions from @c float and @c double to @c std::int32_t, @c std::int16_t and @c std::uint8_t
+			 saturate once to @c std::int32_t and pack the lanes, with AVX2 if the build enables it or #AML_CPU_DISPATCH finds it, otherwise with SSE2.
+			 The other conversions are <tt>static_cast</tt>s, which the compilers vectorize.
+			 @n
+			 The results of aml::rounding::nearest_even depend on the rounding mode of the floating point environment,
+			 which is the nearest even unless the program changes it, in every kernel and in the scalar remainder
+
+	@see aml::rounding
+*/
+template<class From, class To, std::enable_if_t<detail::is_convertible_number<From> && detail::is_convertible_number<To>, int> = 0>
+void convert_n(const From* const first, const std::size_t count, To* const out, const aml::rounding mode = aml::rounding::truncate) noexcept
+{
+	if constexpr (std::is_floating_point_v<From> && std::is_integral_v<To>) {
+		switch (mode) {
+		case aml::rounding::nearest_even: return detail::convert_rounded<To, aml::rounding::nearest_even>(first, count, out);
+		case aml::rounding::floor: return detail::convert_rounded<To, aml::rounding::floor>(first, count, out);
+		case aml::rounding::ceil: return detail::convert_rounded<To, aml::rounding::ceil>(first, count, out);
+		default: return detail::convert_rounded<To, aml::rounding::truncate>(first, count, out);
+		}
+	} else {
+		(void)mode;
+		for (std::size_t i = 0; i < count; ++i) {
+			out[i] = static_cast<To>(first[i]);
+		}
+	}
+}
+
+}
@@ -0,0 +1,129 @@
+/** @file */
+#pragma once
+
+#include <AML/_AMLCore.hpp>
+
+#include <cstdlib>
+#include <cstring>
+
+#ifdef AML_LIBRARY
+	#define AML_LIBRARY_DISPATCH
+#else
+	#error AML library is required
+#endif
+
+/**
+	@brief Compiles the bulk kernels of the dynamic vectors for AVX2 and AVX-512 in addition to the instruction set of the build
+	@details The kernel for the best instruction set of the processor is selected once, on the first call.
+			 The environment variable @c AML_ISA (@c sse2, @c avx2 or @c avx512) forces the path,
+			 the path which is not supported by the processor falls back to the best supported one.
+			 @n
+			 The dispatched kernels are the element-wise writes (aml::add, aml::sub, aml::scale, aml::assign, the compound assignment operators),
+			 the reductions (aml::dot, aml::sum_of, aml::dist) and the conversions done by them.
+			 Multiplication and addition are never fused and the reductions keep #AML_REDUCTION_LANES lanes on every path,
+			 so all paths give the same results. The wide paths need at least as many lanes as fit in the vector register,
+			 16 or 32 lanes keep more registers busy.
+			 Requires GCC or Clang on x86, otherwise the kernels are compiled only for the instruction set of the build
+
+	@see aml::active_isa()
+*/
+//#define AML_CPU_DISPATCH
+
+#if defined(AML_CPU_DISPATCH) && (AML_GCC || AML_CLANG) && (defined(__x86_64__) || defined(__i386__))
+	#define AML_DISPATCH_X86 1
+#else
+	#define AML_DISPATCH_X86 0
+#endif
+
+#if AML_DISPATCH_X86
+	#if AML_CLANG
+		#define AML_TARGET_AVX2 __attribute__((target("avx2")))
+		#define AML_TARGET_AVX512 __attribute__((target("avx2,avx512f,avx512dq,avx512bw,avx512vl")))
+	#else
+		// AVX-512 implies FMA, which GCC contracts across the statements unless it is disabled for the function.
+		// The reductions have #AML_REDUCTION_LANES lanes, so 512-bit vectors would be split between the blocks
+		#define AML_TARGET_AVX2 __attribute__((target("avx2"), optimize("fp-contract=off")))
+		#define AML_TARGET_AVX512 __attribute__((target("avx2,avx512f,avx512dq,avx512bw,avx512vl,prefer-vector-width=256"), optimize("fp-contract=off")))
+	#endif
+#endif
+
+namespace aml
+{
+
+/**
+	@brief Instruction set of the dispatched kernels
+*/
+enum class cpu_isa
+{
+	sse2,	///< The instruction set of the build (SSE2 for x86-64)
+	avx2,	///< AVX2
+	avx512	///< AVX-512 F, DQ, BW and VL
+};
+
+/**
+	@brief Name of the instruction set, the same as the value of the @c AML_ISA environment variable
+*/
+[[nodiscard]] inline
+const char* isa_name(const aml::cpu_isa isa) noexcept
+{
+	switch (isa) {
+	case aml::cpu_isa::avx512: return "avx512";
+	case aml::cpu_isa::avx2: return "avx2";
+	default: return "sse2";
+	}
+}
+
+/**
+	@brief The best instruction set supported by the processor and the operating system
+	@details Always aml::cpu_isa::sse2 if #AML_CPU_DISPATCH is not defined
+*/
+[[nodiscard]] inline
+aml::cpu_isa detected_isa() noexcept
+{
+#if AML_DISPATCH_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") &&
+		__builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vl")) {
+		return aml::cpu_isa::avx512;
+	}
+	if (__builtin_cpu_supports("avx2")) {
+		return aml::cpu_isa::avx2;
+	}
+#endif
+	return aml::cpu_isa::sse2;
+}
+
+namespace detail
+{
+	inline
+	aml::cpu_isa select_isa() noexcept
+	{
+		const aml::cpu_isa detected = aml::detected_isa();
+		const char* const forced = std::getenv("AML_ISA");
+		if (forced == nullptr) {
+			return detected;
+		}
+
+		for (const aml::cpu_isa isa : {aml::cpu_isa::sse2, aml::cpu_isa::avx2, aml::cpu_isa::avx512}) {
+			if (std::strcmp(forced, aml::isa_name(isa)) == 0) {
+				return (isa < detected) ? isa : detected;
+			}
+		}
+		return detected;
+	}
+}
+
+/**
+	@brief Instruction set of the kernels which are used by the dynamic vectors
+	@details Selected on the first call: aml::detected_isa() or the @c AML_ISA environment variable if the processor supports it
+
+	@see #AML_CPU_DISPATCH
+*/
+[[nodiscard]] inline
+aml::cpu_isa active_isa() noexcept
+{
+	static const aml::cpu_isa isa = detail::select_isa();
+	return isa;
+}
+
+}
@@ -0,0 +1,357 @@
+/** @file */
+#pragma once
+
+#include <AML/Vector.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#ifdef AML_LIBRARY
+	#define AML_LIBRARY_DOUBLE_DOUBLE
+#else
+	#error AML library is required
+#endif
+
+namespace aml
+{
+
+namespace detail
+{
+	/**
+		@brief Knuth's TwoSum: <tt>sum + error</tt> is exactly <tt>left + right</tt>
+	*/
+	[[nodiscard]] /** @cond */ AML_FORCEINLINE /** @endcond */ constexpr
+	double two_sum(const double left, const double right, double& error) noexcept
+	{
+		const double sum = left + right;
+		const double right_part = sum - left;
+		error = (left - (sum - right_part)) + (right - right_part);
+		return sum;
+	}
+
+	/**
+		@brief Dekker's FastTwoSum, the same as detail::two_sum() if the exponent of @p left is not less than the exponent of @p right
+	*/
+	[[nodiscard]] /** @cond */ AML_FORCEINLINE /** @endcond */ constexpr
+	double fast_two_sum(const double left, const double right, double& error) noexcept
+	{
+		const double sum = left + right;
+		error = right - (sum - left);
+		return sum;
+	}
+
+	/**
+		@brief <tt>product + error</tt> is exactly <tt>left * right</tt>
+		@details The error is computed by FMA if it is fast (@c FP_FAST_FMA), otherwise by Dekker's product of the halves of the mantissas
+	*/
+	[[nodiscard]] /** @cond */ AML_FORCEINLINE /** @endcond */ constexpr
+	double two_prod(const double left, const double right, double& error) noexcept
+	{
+		const double product = left * right;
+#ifdef FP_FAST_FMA
+		if (!AML_IS_CONSTANT_EVALUATED()) {
+			error = std::fma(left, right, -product);
+			return product;
+		}
+#endif
+		// Veltkamp's splitting by 2^27 + 1 into 26 and 27 bits
+		constexpr double splitter = 134217729.0;
+		const double left_scaled = splitter * left;
+		const double left_high = left_scaled - (left_scaled - left);
+		const double left_low = left - left_high;
+		const double right_scaled = splitter * right;
+		const double right_high = right_scaled - (right_scaled - right);
+		const double right_low = right - right_high;
+		error = (((left_high * right_high - product) + left_high * right_low) + left_low * right_high) + left_low * right_low;
+		return product;
+	}
+
+	/**
+		@brief <tt>left * right + addend</tt>, rounded once if FMA is fast
+		@details Computes the small terms of the products, which do not need the exact rounding
+	*/
+	[[nodiscard]] /** @cond */ AML_FORCEINLINE /** @endcond */ constexpr
+	double muladd_term(const double left, const double right, const double addend) noexcept
+	{
+#ifdef FP_FAST_FMA
+		if (!AML_IS_CONSTANT_EVALUATED()) {
+			return std::fma(left, right, addend);
+		}
+#endif
+		return left * right + addend;
+	}
+}
+
+/**
+	@brief Double-word number, the unevaluated sum of two @c double numbers with about 106 significant bits and the range of @c double
+	@details The high part is the sum rounded to @c double and the low part is its rounding error.
+			 The operations are the algorithms of Joldes, Muller and Popescu (2017) built from the error-free transformations
+			 (detail::two_sum(), detail::two_prod()): the relative error of the addition is below @f$ 3u^2 @f$,
+			 of the multiplication below @f$ 5u^2 @f$ and of the division below @f$ 15u^2 @f$, where @f$ u = 2^{-53} @f$.
+			 The products use FMA if it is fast (@c FP_FAST_FMA), otherwise Dekker's product, which is 3 times longer.
+			 The operations with the @c double operand are shorter than the ones with two double-word numbers.
+			 @n
+			 The conversion from the arithmetic types is implicit and exact,
+			 the conversion to them is explicit and rounds the high and the low parts to the type.
+			 The default constructor leaves the value uninitialized like the one of @c double.
+			 @n
+			 As the @c OutType of aml::dot and aml::sum_of it is the accumulator of the reduction (aml::is_compensated_accumulator),
+			 the products of aml::dot are exact (double_double::product()) and the accumulation is compensated,
+			 so the result is as accurate as the sum in 106 bits rounded to @c double in the end.
+			 As the element of aml::Vector it keeps the accuracy across the element-wise operations.
+
+	@warning The algorithms rely on the rounding of every operation, the fast math options of the compilers (@c -ffast-math, @c /fp:fast) break them
+*/
+class double_double
+{
+public:
+
+	double_double() noexcept = default;
+
+	/// Exact for @c long double with up to 106 significant bits and for the 64-bit integers
+	template<class T, std::enable_if_t<std::is_arithmetic_v<T>, int> = 0> constexpr
+	double_double(const T value) noexcept
+		: m_high(static_cast<double>(value)), m_low(0.)
+	{
+		if constexpr (std::is_integral_v<T> && (std::numeric_limits<T>::digits > std::numeric_limits<double>::digits)) {
+			// Both halves of the bits are exact in double
+			const T low_bits = static_cast<T>(value % (T(1) << 32));
+			m_high = detail::two_sum(static_cast<double>(value - low_bits), static_cast<double>(low_bits), m_low);
+		} else if constexpr (std::is_floating_point_v<T> && (std::numeric_limits<T>::digits > std::numeric_limits<double>::digits)) {
+			m_low = static_cast<double>(value - static_cast<T>(m_high));
+		}
+	}
+
+	/// The sum of @p high and @p low
+	constexpr
+	double_double(const double high, const double low) noexcept
+		: m_high(high), m_low(0.)
+	{
+		m_high = detail::two_sum(high, low, m_low);
+	}
+
+	[[nodiscard]] constexpr
+	double high() const noexcept { return m_high; }
+
+	[[nodiscard]] constexpr
+	double low() const noexcept { return m_low; }
+
+	/**
+		@brief Converts the sum of the parts, the integers are truncated toward zero like @c static_cast
+		@details The low part is less than the half of the ulp of the high part, so it changes the truncation only if the high part is integral.
+				 Then the truncated low part is added to the high part, and the fraction of the low part with the opposite sign takes one more unit toward zero
+	*/
+	template<class T, std::enable_if_t<std::is_arithmetic_v<T>, int> = 0> [[nodiscard]] explicit constexpr
+	operator T() const noexcept
+	{
+		if constexpr (std::is_floating_point_v<T>) {
+			return static_cast<T>(m_high) + static_cast<T>(m_low);
+		} else if constexpr (std::is_same_v<T, bool>) {
+			return m_high != 0.;
+		} else {
+			constexpr double exact_limit = static_cast<double>(std::uint64_t{1} << std::numeric_limits<double>::digits);
+			const double magnitude = (m_high < 0.) ? -m_high : m_high;
+			if (magnitude < exact_limit) {
+				const T high = static_cast<T>(m_high);
+				if (static_cast<double>(high) != m_high) {
+					return high;
+				}
+				return static_cast<T>(high + static_cast<T>(truncated_low()));
+			}
+			// The high part can be the power of two just out of the range of T, the halves are in the range
+			const T half = static_cast<T>(m_high * 0.5);
+			return static_cast<T>(static_cast<T>(half + static_cast<T>(truncated_low())) + half);
+		}
+	}
+
+	/**
+		@brief Exact product of @p left and @p right
+	*/
+	[[nodiscard]] static constexpr
+	double_double product(const double left, const double right) noexcept
+	{
+		double error = 0.;
+		const double high = detail::two_prod(left, right, error);
+		return double_double(parts_tag{}, high, error);
+	}
+
+	[[nodiscard]] static constexpr
+	double_double product(const double_double& left, const double_double& right) noexcept {
+		return left * right;
+	}
+
+	[[nodiscard]] constexpr
+	double_double operator-() const noexcept { return double_double(parts_tag{}, -m_high, -m_low); }
+
+	[[nodiscard]] constexpr
+	double_double operator+() const noexcept { return *this; }
+
+	[[nodiscard]] friend constexpr
+	double_double operator+(const double_double& left, const double right) noexcept
+	{
+		double error = 0.;
+		const double sum = detail::two_sum(left.m_high, right, error);
+		return normalized(sum, left.m_low + error);
+	}
+
+	[[nodiscard]] friend constexpr
+	double_double operator+(const double left, const double_double& right) noexcept { return right + left; }
+
+	[[nodiscard]] friend constexpr
+	double_double operator+(const double_double& left, const double_double& right) noexcept
+	{
+		double high_error = 0.;
+		double low_error = 0.;
+		const double high = detail::two_sum(left.m_high, right.m_high, high_error);
+		const double low = detail::two_sum(left.m_low, right.m_low, low_error);
+
+		const double_double out = normalized(high, high_error + low);
+		return normalized(out.m_high, out.m_low + low_error);
+	}
+
+	[[nodiscard]] friend constexpr
+	double_double operator-(const double_double& left, const double right) noexcept { return left + (-right); }
+
+	[[nodiscard]] friend constexpr
+	double_double operator-(const double left, const double_double& right) noexcept { return (-right) + left; }
+
+	[[nodiscard]] friend constexpr
+	double_double operator-(const double_double& left, const double_double& right) noexcept { return left + (-right); }
+
+	[[nodiscard]] friend constexpr
+	double_double operator*(const double_double& left, const double right) noexcept
+	{
+		double error = 0.;
+		const double high = detail::two_prod(left.m_high, right, error);
+		return normalized(high, detail::muladd_term(left.m_low, right, error));
+	}
+
+	[[nodiscard]] friend constexpr
+	double_double operator*(const double left, const double_double& right) noexcept { return right * left; }
+
+	[[nodiscard]] friend constexpr
+	double_double operator*(const double_double& left, const double_double& right) noexcept
+	{
+		double error = 0.;
+		const double high = detail::two_prod(left.m_high, right.m_high, error);
+		const double cross = detail::muladd_term(left.m_low, right.m_high, detail::muladd_term(left.m_high, right.m_low, left.m_low * right.m_low));
+		return normalized(high, error + cross);
+	}
+
+	[[nodiscard]] friend constexpr
+	double_double operator/(const double_double& left, const double right) noexcept
+	{
+		const double quotient = left.m_high / right;
+		double error = 0.;
+		const double product = detail::two_prod(quotient, right, error);
+		const double remainder = ((left.m_high - product) - error) + left.m_low;
+		return normalized(quotient, remainder / right);
+	}
+
+	[[nodiscard]] friend constexpr
+	double_double operator/(const double left, const double_double& right) noexcept { return double_double(left) / right; }
+
+	[[nodiscard]] friend constexpr
+	double_double operator/(const double_double& left, const double_double& right) noexcept
+	{
+		const double quotient = left.m_high / right.m_high;
+		const double_double product = right * quotient;
+		const double remainder = (left.m_high - product.m_high) + (left.m_low - product.m_low);
+		return normalized(quotient, remainder / right.m_high);
+	}
+
+	template<class T> constexpr double_double& operator+=(const T& value) noexcept { return *this = *this + value; }
+	template<class T> constexpr double_double& operator-=(const T& value) noexcept { return *this = *this - value; }
+	template<class T> constexpr double_double& operator*=(const T& value) noexcept { return *this = *this * value; }
+	template<class T> constexpr double_double& operator/=(const T& value) noexcept { return *this = *this / value; }
+
+	// The parts are normalized, so the numbers are ordered by the high parts first
+	[[nodiscard]] friend constexpr
+	bool operator==(const double_double& left, const double_double& right) noexcept { return (left.m_high == right.m_high) && (left.m_low == right.m_low); }
+
+	[[nodiscard]] friend constexpr
+	bool operator!=(const double_double& left, const double_double& right) noexcept { return !(left == right); }
+
+	[[nodiscard]] friend constexpr
+	bool operator<(const double_double& left, const double_double& right) noexcept
+	{
+		return (left.m_high < right.m_high) || ((left.m_high == right.m_high) && (left.m_low < right.m_low));
+	}
+
+	[[nodiscard]] friend constexpr
+	bool operator>(const double_double& left, const double_double& right) noexcept { return right < left; }
+
+	[[nodiscard]] friend constexpr
+	bool operator<=(const double_double& left, const double_double& right) noexcept { return !(right < left); }
+
+	[[nodiscard]] friend constexpr
+	bool operator>=(const double_double& left, const double_double& right) noexcept { return !(left < right); }
+
+private:
+	struct parts_tag {};
+
+	/// @p high and @p low are normalized already
+	constexpr
+	double_double(parts_tag, const double high, const double low) noexcept
+		: m_high(high), m_low(low) {}
+
+	/// Renormalizes the sum of @p high and the smaller @p low
+	[[nodiscard]] /** @cond */ AML_FORCEINLINE /** @endcond */ static constexpr
+	double_double normalized(const double high, const double low) noexcept
+	{
+		double error = 0.;
+		const double sum = detail::fast_two_sum(high, low, error);
+		return double_double(parts_tag{}, sum, error);
+	}
+
+	/// The low part truncated toward zero of the sum if the high part is integral
+	[[nodiscard]] constexpr
+	std::int64_t truncated_low() const noexcept
+	{
+		std::int64_t low = static_cast<std::int64_t>(m_low);
+		if (static_cast<double>(low) != m_low) {
+			if ((m_high > 0.) && (m_low < 0.)) {
+				--low;
+			} else if ((m_high < 0.) && (m_low > 0.)) {
+				++low;
+			}
+		}
+		return low;
+	}
+
+	double m_high;
+	double m_low;
+};
+
+static_assert(sizeof(aml::double_double) == (2 * sizeof(double)) && std::is_trivially_copyable_v<aml::double_double>);
+
+template<>
+struct is_compensated_accumulator_body<aml::double_double> : std::true_type {};
+
+/**
+	@brief Dot product of @p left and @p right with the exact products accumulated in aml::double_double
+	@details The same as aml::dot with aml::double_double as @c OutType
+
+	@see aml::dot
+*/
+template<class Left, class Right, 
+	std::enable_if_t<detail::is_vector_operand<Left> && detail::is_vector_operand<Right>, int> = 0
+> [[nodiscard]] constexpr
+aml::double_double compensated_dot(const Left& left, const Right& right) noexcept {
+	return aml::dot.template operator()<aml::double_double>(left, right);
+}
+
+/**
+	@brief Sum of the elements of @p vec accumulated in aml::double_double
+	@details The same as aml::sum_of with aml::double_double as @c OutType
+
+	@see aml::sum_of
+*/
+template<class Vec, std::enable_if_t<detail::is_vector_operand<Vec>, int> = 0> [[nodiscard]] constexpr
+aml::double_double compensated_sum(const Vec& vec) noexcept {
+	return aml::sum_of<aml::double_double>(vec);
+}
+
+}
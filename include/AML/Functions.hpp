@@ -2,6 +2,7 @@
 #pragma once
 
 #include <AML/Tools.hpp>
+#include <AML/Conversions.hpp>
 #include <limits>
 #include <string_view>
 
@@ -77,7 +78,9 @@ decltype(auto) min(First&& f, Ts&&... vals) noexcept
 /**
 	@brief The sum of the input variadic arguments
 */
-template<class First, class... Rest> [[nodiscard]] constexpr
+template<class First, class... Rest, 
+	std::enable_if_t<(sizeof...(Rest) > 0), int> = 0
+> [[nodiscard]] constexpr
 auto sum_of(First&& first, Rest&&... rest) noexcept {
 	decltype(first + (rest + ...)) out = std::forward<First>(first);
 	([&] {
@@ -261,13 +264,13 @@ bool positive(const T& val) noexcept {
 template<class OutType = aml::selectable_unused, class T> [[nodiscard]] constexpr
 decltype(auto) floor(T&& val) noexcept
 {
-	if constexpr (std::is_integral_v<T>) { 
+	using value_type = aml::remove_cvref<T>;
+	if constexpr (std::is_integral_v<value_type>) { 
 		return aml::selectable_convert<OutType>(val);
 	} 
-	else if constexpr (std::is_floating_point_v<T>) { 
-		const std::int_fast64_t t = static_cast<std::int_fast64_t>(val);
-		using conv = aml::selectable_type<OutType, T>;
-		return static_cast<conv>(t - (static_cast<T>(t) > val ? 1 : 0));
+	else if constexpr (std::is_floating_point_v<value_type>) { 
+		using conv = aml::selectable_type<OutType, value_type>;
+		return static_cast<conv>(detail::round_integral<aml::rounding::floor>(static_cast<value_type>(val)));
 	} 
 	else {
 		static_assert(aml::always_false<T>, "Flooring not supported type");
@@ -280,13 +283,13 @@ decltype(auto) floor(T&& val) noexcept
 template<class OutType = aml::selectable_unused, class T> [[nodiscard]] constexpr
 decltype(auto) ceil(T&& val) noexcept
 {
-	if constexpr (std::is_integral_v<T>) {
+	using value_type = aml::remove_cvref<T>;
+	if constexpr (std::is_integral_v<value_type>) {
 		return aml::selectable_convert<OutType>(val);
 	}
-	else if constexpr (std::is_floating_point_v<T>) {
-		const auto t = static_cast<std::int_fast64_t>(val);
-		using conv = aml::selectable_type<OutType, T>;
-		return static_cast<conv>(t + (static_cast<T>(t) < val ? 1 : 0));
+	else if constexpr (std::is_floating_point_v<value_type>) {
+		using conv = aml::selectable_type<OutType, value_type>;
+		return static_cast<conv>(detail::round_integral<aml::rounding::ceil>(static_cast<value_type>(val)));
 	} 
 	else {
 		static_assert(aml::always_false<T>, "Ceiling not supported type");
@@ -294,18 +297,26 @@ decltype(auto) ceil(T&& val) noexcept
 }
 
 /**
-	@brief Rounds @p val to the nearest value
+	@brief Rounds @p val to the nearest value, the halfway cases away from zero
 */
 template<class OutType = aml::selectable_unused, class T> [[nodiscard]] constexpr
 decltype(auto) round(T&& val) noexcept
 {
-	if constexpr (std::is_integral_v<T>) {
+	using value_type = aml::remove_cvref<T>;
+	if constexpr (std::is_integral_v<value_type>) {
 		return aml::selectable_convert<OutType>(val);
 	} 
-	else if constexpr (std::is_floating_point_v<T>) {
-		return (val >= static_cast<T>(0)) ? 
-			aml::floor<OutType>(val + static_cast<T>(0.5)) 
-		  : aml::floor<OutType>(val - static_cast<T>(0.5));
+	else if constexpr (std::is_floating_point_v<value_type>) {
+		const value_type x = val;
+		// Adding 0.5 before the rounding is inexact for the numbers just below 0.5
+		value_type t = detail::round_integral<aml::rounding::truncate>(x);
+		if ((x - t) >= static_cast<value_type>(0.5)) {
+			t += static_cast<value_type>(1);
+		} else if ((t - x) >= static_cast<value_type>(0.5)) {
+			t -= static_cast<value_type>(1);
+		}
+		using conv = aml::selectable_type<OutType, value_type>;
+		return static_cast<conv>(t);
 	} 
 	else {
 		static_assert(aml::always_false<T>, "Rounding not supported type");
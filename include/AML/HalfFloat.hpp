@@ -0,0 +1,257 @@
+/** @file */
+#pragma once
+
+#include <AML/Tools.hpp>
+#include <AML/Dispatch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(__F16C__) || AML_DISPATCH_X86
+	#include <immintrin.h>
+	#define AML_HAS_F16C_KERNELS 1
+#else
+	#define AML_HAS_F16C_KERNELS 0
+#endif
+
+#if defined(__F16C__)
+	#define AML_TARGET_F16C
+#elif AML_DISPATCH_X86
+	#define AML_TARGET_F16C __attribute__((target("avx2,f16c")))
+#endif
+
+namespace aml
+{
+
+namespace detail
+{
+	inline
+	std::uint32_t float_bits(const float value) noexcept
+	{
+		std::uint32_t out;
+		std::memcpy(&out, &value, sizeof(out));
+		return out;
+	}
+
+	inline
+	float float_from_bits(const std::uint32_t bits) noexcept
+	{
+		float out;
+		std::memcpy(&out, &bits, sizeof(out));
+		return out;
+	}
+
+	/**
+		@brief IEEE 754 binary16: 1 sign bit, 5 exponent bits, 10 mantissa bits
+		@details The conversions are branchless, so the compilers vectorize the loops over them
+	*/
+	struct binary16_format
+	{
+		static float to_float(const std::uint16_t bits) noexcept
+		{
+			// The scale by 2^112 rebiases the exponent and normalizes the subnormals
+			const float magnitude = detail::float_from_bits(static_cast<std::uint32_t>(bits & 0x7fffu) << 13) * 0x1p112f;
+			const std::uint32_t inf_nan = (magnitude >= 65536.f) ? 0x7f800000u : 0u;
+			return detail::float_from_bits(detail::float_bits(magnitude) | inf_nan | (static_cast<std::uint32_t>(bits & 0x8000u) << 16));
+		}
+
+		static std::uint16_t from_float(const float value) noexcept
+		{
+			std::uint32_t magnitude = detail::float_bits(value);
+			const std::uint32_t sign = magnitude & 0x80000000u;
+			magnitude ^= sign;
+
+			// All the cases are computed and selected, so the loops over the conversion are vectorized
+			const std::uint32_t overflow = (magnitude > 0x7f800000u) ? 0x7e00u : 0x7c00u;
+			// Adding 0.5 moves the mantissa of the subnormal result to its place and rounds it to the nearest even
+			const std::uint32_t subnormal = detail::float_bits(detail::float_from_bits(magnitude) + 0.5f) - 0x3f000000u;
+			const std::uint32_t normal = (magnitude + ((15u - 127u) << 23) + 0xfffu + ((magnitude >> 13) & 1u)) >> 13;
+
+			const std::uint32_t is_overflow = 0u - static_cast<std::uint32_t>(magnitude >= 0x47800000u);
+			const std::uint32_t is_subnormal = 0u - static_cast<std::uint32_t>(magnitude < 0x38800000u);
+			const std::uint32_t out = (overflow & is_overflow) | (subnormal & is_subnormal) | (normal & ~(is_overflow | is_subnormal));
+			return static_cast<std::uint16_t>(out | (sign >> 16));
+		}
+	};
+
+	/**
+		@brief bfloat16: the upper half of the IEEE 754 binary32, 8 exponent bits and 7 mantissa bits
+	*/
+	struct bfloat16_format
+	{
+		static float to_float(const std::uint16_t bits) noexcept {
+			return detail::float_from_bits(static_cast<std::uint32_t>(bits) << 16);
+		}
+
+		static std::uint16_t from_float(const float value) noexcept
+		{
+			const std::uint32_t bits = detail::float_bits(value);
+			if ((bits & 0x7fffffffu) > 0x7f800000u) {
+				return static_cast<std::uint16_t>((bits >> 16) | 0x40u); // Quiet NaN
+			}
+			return static_cast<std::uint16_t>((bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16);
+		}
+	};
+}
+
+/**
+	@brief 2-byte floating point number which is stored in the @p Format and computes in @c float
+	@details Converts implicitly to @c float, so the arithmetic operators and the comparisons are the ones of @c float
+			 and the results are @c float, like the integral promotion of the small integers.
+			 The conversion from @c float is explicit and rounds to the nearest even.
+			 The default constructor leaves the value uninitialized like the one of @c float.
+			 @n
+			 As the element of aml::Vector it halves the memory and the memory traffic of @c float.
+			 aml::dot, aml::dist and aml::sum_of accumulate it in @c float, the element-wise operations give @c float vectors,
+			 the output kernels (aml::add, the compound assignment operators) round the results back
+
+	@see aml::float16, aml::bfloat16, aml::convert_n()
+*/
+template<class Format>
+class half_float
+{
+public:
+
+	using format_type = Format;
+
+	half_float() noexcept = default;
+
+	explicit half_float(const float value) noexcept
+		: m_bits(Format::from_float(value)) {}
+
+	/// Rounds @p value to @c float first
+	template<class T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, float>, int> = 0>
+	explicit half_float(const T value) noexcept
+		: half_float(static_cast<float>(value)) {}
+
+	operator float() const noexcept { return Format::to_float(m_bits); }
+
+	[[nodiscard]] static
+	half_float from_bits(const std::uint16_t bits) noexcept
+	{
+		half_float out;
+		out.m_bits = bits;
+		return out;
+	}
+
+	[[nodiscard]]
+	std::uint16_t bits() const noexcept { return m_bits; }
+
+	template<class T> half_float& operator+=(const T& value) noexcept { return *this = half_float(static_cast<float>(*this) + value); }
+	template<class T> half_float& operator-=(const T& value) noexcept { return *this = half_float(static_cast<float>(*this) - value); }
+	template<class T> half_float& operator*=(const T& value) noexcept { return *this = half_float(static_cast<float>(*this) * value); }
+	template<class T> half_float& operator/=(const T& value) noexcept { return *this = half_float(static_cast<float>(*this) / value); }
+
+private:
+	std::uint16_t m_bits;
+};
+
+/**
+	@brief IEEE 754 half precision number, 11 significant bits and the range up to 65504
+*/
+using float16 = aml::half_float<detail::binary16_format>;
+
+/**
+	@brief Brain floating point number, 8 significant bits and the range of @c float
+*/
+using bfloat16 = aml::half_float<detail::bfloat16_format>;
+
+static_assert(sizeof(aml::float16) == 2 && std::is_trivially_copyable_v<aml::float16>);
+static_assert(sizeof(aml::bfloat16) == 2 && std::is_trivially_copyable_v<aml::bfloat16>);
+
+template<class Format>
+struct accumulation_type_body<aml::half_float<Format>> {
+	using type = float;
+};
+
+namespace detail
+{
+#if AML_HAS_F16C_KERNELS
+	AML_TARGET_F16C inline
+	void f16c_to_float(const aml::float16* const first, const std::size_t count, float* const out) noexcept
+	{
+		std::size_t i = 0;
+		for (; (i + 8) <= count; i += 8) {
+			const __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+			_mm256_storeu_ps(out + i, _mm256_cvtph_ps(half));
+		}
+		for (; i < count; ++i) {
+			out[i] = static_cast<float>(first[i]);
+		}
+	}
+
+	AML_TARGET_F16C inline
+	void f16c_from_float(const float* const first, const std::size_t count, aml::float16* const out) noexcept
+	{
+		std::size_t i = 0;
+		for (; (i + 8) <= count; i += 8) {
+			const __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(first + i), _MM_FROUND_TO_NEAREST_INT);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), half);
+		}
+		for (; i < count; ++i) {
+			out[i] = aml::float16(first[i]);
+		}
+	}
+#endif
+
+	/**
+		@brief Checks if the F16C conversion instructions are available: in the build or through aml::active_isa()
+		@details Every processor with AVX2 has F16C
+	*/
+	inline
+	bool has_f16c() noexcept
+	{
+#if defined(__F16C__)
+		return true;
+#elif AML_DISPATCH_X86
+		return (aml::active_isa() != aml::cpu_isa::sse2);
+#else
+		return false;
+#endif
+	}
+}
+
+/**
+	@brief Converts @p count half precision numbers from @p first to @c float into @p out
+	@details Uses the F16C instructions for aml::float16 if the build enables them or #AML_CPU_DISPATCH finds them,
+			 otherwise the branchless loop which the compiler vectorizes. The conversion is exact
+*/
+template<class Format>
+void convert_n(const aml::half_float<Format>* const first, const std::size_t count, float* const out) noexcept
+{
+#if AML_HAS_F16C_KERNELS
+	if constexpr (std::is_same_v<Format, detail::binary16_format>) {
+		if (detail::has_f16c()) {
+			return detail::f16c_to_float(first, count, out);
+		}
+	}
+#endif
+	for (std::size_t i = 0; i < count; ++i) {
+		out[i] = static_cast<float>(first[i]);
+	}
+}
+
+/**
+	@brief Converts @p count @c float numbers from @p first to half precision into @p out, rounding to the nearest even
+	@details The same as convert_n(const aml::half_float<Format>*, std::size_t, float*) in reverse.
+			 The payloads of NaNs can differ between the F16C instructions and the loop
+*/
+template<class Format>
+void convert_n(const float* const first, const std::size_t count, aml::half_float<Format>* const out) noexcept
+{
+#if AML_HAS_F16C_KERNELS
+	if constexpr (std::is_same_v<Format, detail::binary16_format>) {
+		if (detail::has_f16c()) {
+			return detail::f16c_from_float(first, count, out);
+		}
+	}
+#endif
+	for (std::size_t i = 0; i < count; ++i) {
+		out[i] = aml::half_float<Format>(first[i]);
+	}
+}
+
+}
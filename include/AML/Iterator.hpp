@@ -5,6 +5,8 @@
 #include <cstddef>
 #include <type_traits>
 #include <iterator>
+#include <utility>
+#include <memory>
 
 namespace aml {
 
@@ -20,7 +22,8 @@ public:
 	using difference_type = Difference;
 	using object_size_type = typename Object::size_type;
 
-	using reference = value_type&;
+	/// The type that the object index operator returns (can be a value type for computed objects)
+	using reference = decltype(std::declval<Object&>()[std::declval<object_size_type>()]);
 	using const_reference = const value_type&;
 
 	using pointer = value_type*;
@@ -28,39 +31,41 @@ public:
 
 	constexpr
 	IndexIterator(Object& object, difference_type startshift) noexcept 
-		: m_shift(startshift), m_object(object) {}
+		: m_shift(startshift), m_object(std::addressof(object)) {}
 
 	[[nodiscard]] constexpr
 	bool operator==(const IndexIterator& right) const noexcept {
-		return (m_shift == right.m_shift) && (&m_object == &(right.m_object));
+		AML_DEBUG_VERIFY(m_object == right.m_object, "To compare, you must to have the same object");
+		return m_shift == right.m_shift;
 	}
 
 	[[nodiscard]] constexpr
 	bool operator!=(const IndexIterator& right) const noexcept {
-		return (m_shift != right.m_shift) || (&m_object != &(right.m_object));
+		AML_DEBUG_VERIFY(m_object == right.m_object, "To compare, you must to have the same object");
+		return m_shift != right.m_shift;
 	}
 
 	[[nodiscard]] constexpr
 	bool operator<(const IndexIterator& right) const noexcept {
-		AML_DEBUG_VERIFY(&m_object == &right.m_object, "To compare, you must to have the same object");
+		AML_DEBUG_VERIFY(m_object == right.m_object, "To compare, you must to have the same object");
 		return m_shift < right.m_shift;
 	}
 
 	[[nodiscard]] constexpr
 	bool operator>(const IndexIterator& right) const noexcept {
-		AML_DEBUG_VERIFY(&m_object == &right.m_object, "To compare, you must to have the same object");
+		AML_DEBUG_VERIFY(m_object == right.m_object, "To compare, you must to have the same object");
 		return m_shift > right.m_shift;
 	}
 
 	[[nodiscard]] constexpr
 	bool operator<=(const IndexIterator& right) const noexcept {
-		AML_DEBUG_VERIFY(&m_object == &right.m_object, "To compare, you must to have the same object");
+		AML_DEBUG_VERIFY(m_object == right.m_object, "To compare, you must to have the same object");
 		return m_shift <= right.m_shift;
 	}
 
 	[[nodiscard]] constexpr
 	bool operator>=(const IndexIterator& right) const noexcept {
-		AML_DEBUG_VERIFY(&m_object == &right.m_object, "To compare, you must to have the same object");
+		AML_DEBUG_VERIFY(m_object == right.m_object, "To compare, you must to have the same object");
 		return m_shift >= right.m_shift;
 	}
 
@@ -118,23 +123,23 @@ public:
 	}
 
 	[[nodiscard]] constexpr
-	std::conditional_t<std::is_const_v<Object>, const_reference, reference> operator*() noexcept {
-		return m_object[static_cast<object_size_type>(m_shift)];
+	reference operator*() const noexcept {
+		return (*m_object)[static_cast<object_size_type>(m_shift)];
 	}
 
 	[[nodiscard]] constexpr
 	std::conditional_t<std::is_const_v<Object>, const_pointer, pointer> operator->() noexcept {
-		return std::addressof(m_object[static_cast<object_size_type>(m_shift)]);
+		return std::addressof((*m_object)[static_cast<object_size_type>(m_shift)]);
 	}
 
 	[[nodiscard]] constexpr
-	std::conditional_t<std::is_const_v<Object>, const_reference, reference> operator[](difference_type off) noexcept {
-		return m_object[static_cast<object_size_type>(m_shift + off)];
+	reference operator[](difference_type off) const noexcept {
+		return (*m_object)[static_cast<object_size_type>(m_shift + off)];
 	}
 
 private:
 	difference_type m_shift;
-	Object& m_object;
+	Object* m_object;
 };
 
 template<class Object, class Difference = std::ptrdiff_t>
@@ -0,0 +1,449 @@
+/**
+	@file
+	@details The threads library is linked through the @c AML::parallel CMake target, the @c AML target does not require it
+*/
+#pragma once
+
+#include <AML/Vector.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#ifdef AML_LIBRARY
+	#define AML_LIBRARY_PARALLEL
+#else
+	#error AML library is required
+#endif
+
+/**
+	@brief Minimum size of the vector whose parallel operation is split across the threads
+	@details The smaller vectors are processed serially by the calling thread
+*/
+#ifndef AML_PARALLEL_THRESHOLD
+	#define AML_PARALLEL_THRESHOLD 65536
+#endif
+
+/**
+	@brief Number of the threads of the parallel operations including the calling thread
+	@details @c 0 uses @c std::thread::hardware_concurrency()
+*/
+#ifndef AML_PARALLEL_THREADS
+	#define AML_PARALLEL_THREADS 0
+#endif
+
+namespace aml
+{
+
+/**
+	@brief Execution policy of the vector operations which are split across the threads
+	@details Used as the first argument of aml::dot, aml::sum_of, aml::dist, aml::normalize, aml::is_equal, aml::assign and the output kernels
+
+	@see aml::par
+*/
+class parallel_policy
+{
+public:
+	explicit constexpr parallel_policy() noexcept = default;
+};
+
+/**
+	@brief Execution policy of the vector operations which are split across the threads and vectorized
+	@details Behaves as aml::parallel_policy: the element loops of both policies are vectorized,
+			 since the element operations of AML do not synchronize
+
+	@see aml::par_unseq
+*/
+class parallel_unsequenced_policy
+{
+public:
+	explicit constexpr parallel_unsequenced_policy() noexcept = default;
+};
+
+inline constexpr parallel_policy par{};
+inline constexpr parallel_unsequenced_policy par_unseq{};
+
+namespace detail
+{
+	/**
+		@brief Fork-join pool of the worker threads of the parallel vector operations
+		@details The calling thread also executes the tasks.
+				 The run from a task or concurrent with the other run is executed serially by the calling thread
+	*/
+	class ThreadPool
+	{
+	public:
+
+		[[nodiscard]] static
+		ThreadPool& instance() noexcept {
+			static ThreadPool pool;
+			return pool;
+		}
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		/// Number of the threads including the calling thread
+		[[nodiscard]]
+		std::size_t concurrency() const noexcept { return m_workers.size() + 1; }
+
+		/**
+			@brief Calls <tt>task(i)</tt> for every @p i from 0 to @p count and waits for all of them
+		*/
+		template<class Task>
+		void run(const std::size_t count, Task&& task) noexcept
+		{
+			std::unique_lock<std::mutex> run_lock(m_run_mutex, std::try_to_lock);
+			if ((count <= 1) || m_workers.empty() || is_worker() || !run_lock.owns_lock()) {
+				for (std::size_t i = 0; i < count; ++i) {
+					task(i);
+				}
+				return;
+			}
+
+			{
+				const std::lock_guard<std::mutex> lock(m_mutex);
+				m_task = const_cast<void*>(static_cast<const void*>(std::addressof(task)));
+				m_invoke = [](void* const task, const std::size_t i) {
+					(*static_cast<std::remove_reference_t<Task>*>(task))(i);
+				};
+				m_count = count;
+				m_next.store(0, std::memory_order_relaxed);
+				m_busy = m_workers.size();
+				++m_generation;
+			}
+			m_start.notify_all();
+
+			this->execute();
+
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_done.wait(lock, [this] { return (m_busy == 0); });
+		}
+
+	private:
+
+		ThreadPool() noexcept
+		{
+			std::size_t threads = AML_PARALLEL_THREADS;
+			if (threads == 0) {
+				threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+			}
+
+			try {
+				m_workers.reserve(threads - 1);
+				for (std::size_t i = 1; i < threads; ++i) {
+					m_workers.emplace_back([this] { this->work(); });
+				}
+			} catch (...) {
+				// The pool works with the threads which were created
+			}
+		}
+
+		~ThreadPool()
+		{
+			{
+				const std::lock_guard<std::mutex> lock(m_mutex);
+				m_stop = true;
+			}
+			m_start.notify_all();
+			for (auto& worker : m_workers) {
+				worker.join();
+			}
+		}
+
+		static bool& is_worker() noexcept {
+			static thread_local bool value = false;
+			return value;
+		}
+
+		void execute() noexcept
+		{
+			for (std::size_t i = m_next.fetch_add(1, std::memory_order_relaxed); i < m_count; i = m_next.fetch_add(1, std::memory_order_relaxed)) {
+				m_invoke(m_task, i);
+			}
+		}
+
+		void work() noexcept
+		{
+			is_worker() = true;
+
+			std::uint64_t generation = 0;
+			for (;;) {
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_start.wait(lock, [&] { return m_stop || (m_generation != generation); });
+					if (m_stop) return;
+					generation = m_generation;
+				}
+
+				this->execute();
+
+				const std::lock_guard<std::mutex> lock(m_mutex);
+				if (--m_busy == 0) {
+					m_done.notify_one();
+				}
+			}
+		}
+
+		std::vector<std::thread> m_workers;
+
+		std::mutex m_run_mutex;
+		std::mutex m_mutex;
+		std::condition_variable m_start;
+		std::condition_variable m_done;
+
+		void* m_task = nullptr;
+		void (*m_invoke)(void*, std::size_t) = nullptr;
+		std::size_t m_count = 0;
+		std::atomic<std::size_t> m_next{0};
+		std::size_t m_busy = 0;
+		std::uint64_t m_generation = 0;
+		bool m_stop = false;
+	};
+
+	/**
+		@brief Split of [0, size) into the chunks
+		@details Four chunks per thread balance the load. The chunk sizes are the multiples of 64 elements,
+				 so the chunks of the output do not share cache lines
+	*/
+	class ParallelChunks
+	{
+	public:
+		explicit ParallelChunks(const Vectorsize size) noexcept
+			: m_size(size)
+		{
+			const Vectorsize wanted = ThreadPool::instance().concurrency() * 4;
+			m_chunk = ((((size + wanted - 1) / wanted) + 63) / 64) * 64;
+			m_count = (size + m_chunk - 1) / m_chunk;
+		}
+
+		[[nodiscard]] Vectorsize count() const noexcept { return m_count; }
+		[[nodiscard]] Vectorsize begin(const Vectorsize i) const noexcept { return i * m_chunk; }
+		[[nodiscard]] Vectorsize end(const Vectorsize i) const noexcept { return std::min(m_size, (i + 1) * m_chunk); }
+
+	private:
+		Vectorsize m_size;
+		Vectorsize m_chunk;
+		Vectorsize m_count;
+	};
+
+	/**
+		@brief Calls <tt>function(begin, end)</tt> for the chunks of [0, @p size) on the threads of the pool
+		@details Calls <tt>function(0, size)</tt> on the calling thread if @p size is less than #AML_PARALLEL_THRESHOLD
+	*/
+	template<class Function>
+	void parallel_for(const Vectorsize size, Function&& function) noexcept
+	{
+		if (size < AML_PARALLEL_THRESHOLD) {
+			function(Vectorsize{0}, size);
+			return;
+		}
+		const ParallelChunks chunks(size);
+		ThreadPool::instance().run(chunks.count(), [&](const Vectorsize i) {
+			function(chunks.begin(i), chunks.end(i));
+		});
+	}
+
+	template<class T, class Policy, class Map, class Vec, class... Operands>
+	T parallel_reduce([[maybe_unused]] const Policy& policy, Map&& map, const Vec& vec, const Operands&... operands) noexcept
+	{
+		if constexpr (detail::is_lane_reduction<T> && Vec::is_dynamic()) {
+			if (vec.size() >= AML_PARALLEL_THRESHOLD) {
+#ifdef AML_DETERMINISTIC_REDUCTION
+				// The same blocks and the same tree as detail::reduce_blocks(), so the result does not depend on the threads
+				const Vectorsize size = vec.size();
+				const Vectorsize blocks = (size + AML_DETERMINISTIC_BLOCK - 1) / AML_DETERMINISTIC_BLOCK;
+				std::vector<T> partial(blocks);
+				ThreadPool::instance().run(blocks, [&](const Vectorsize block) {
+					const Vectorsize begin = block * AML_DETERMINISTIC_BLOCK;
+					const Vectorsize end = std::min(size, begin + AML_DETERMINISTIC_BLOCK);
+					partial[block] = detail::reduce_range<T, Map&, decltype(detail::lower_operand(operands))...>(
+						map, begin, end, detail::lower_operand(operands)...);
+				});
+				return detail::reduce_tree<T>([&](const Vectorsize block) { return partial[block]; }, 0, blocks);
+#else
+				const ParallelChunks chunks(vec.size());
+				std::vector<T> partial(chunks.count());
+				ThreadPool::instance().run(chunks.count(), [&](const Vectorsize i) {
+					partial[i] = detail::reduce_range<T, Map&, decltype(detail::lower_operand(operands))...>(
+						map, chunks.begin(i), chunks.end(i), detail::lower_operand(operands)...);
+				});
+
+				T out = partial[0];
+				for (Vectorsize i = 1; i < partial.size(); ++i) {
+					out += partial[i];
+				}
+				return out;
+#endif
+			}
+		}
+		return detail::reduce_vector<T>(map, vec, operands...);
+	}
+
+	template<class Left, class Right>
+	bool equal_range(Left left, Right right, const Vectorsize begin, const Vectorsize end) noexcept
+	{
+		for (Vectorsize i = begin; i < end; ++i) {
+			if (aml::not_equal(left[i], right[i])) return false;
+		}
+		return true;
+	}
+}
+
+/**
+	@brief Writes the vector, the vector view or the lazy vector expression into @p out on the threads of the pool
+	@details Element-wise operators are evaluated in parallel with the lazy expressions of the dynamic vectors:
+			 <tt>aml::assign(aml::par, out, a + b * 2.f)</tt>. Serial if the size is less than #AML_PARALLEL_THRESHOLD
+
+	@param out Dynamic vector or vector view with the same size as @p operand.
+			   Can be the same vector as the operands of @p operand, but must not partially overlap with them
+*/
+template<class Policy, class Out, class Operand,
+	std::enable_if_t<detail::is_execution_policy<Policy> && detail::is_vector_operand<Out> && detail::is_vector_operand<Operand>, int> = 0
+>
+void assign([[maybe_unused]] const Policy& policy, Out&& out, const Operand& operand) noexcept
+{
+	detail::verify_vector_size(out, operand);
+	const Vectorsize size = out.size();
+	auto&& dst = detail::lower_output(out);
+	const auto& src = detail::lower_operand(operand);
+	const bool streaming = detail::is_streaming_output<aml::remove_cvref<decltype(dst)>>(size);
+	detail::parallel_for(size, [&](const Vectorsize begin, const Vectorsize end) {
+		detail::write_range(dst, [&](const Vectorsize i) { return src[i]; }, begin, end, streaming, src);
+	});
+}
+
+/**
+	@brief Evaluates the vector expression into the new vector on the threads of the pool
+
+	@see aml::assign(const Policy&, Out&&, const Operand&)
+*/
+template<class Policy, class Operand,
+	std::enable_if_t<detail::is_execution_policy<Policy> && detail::is_vector_operand<Operand>, int> = 0
+> [[nodiscard]]
+auto evaluate(const Policy& policy, const Operand& operand)
+{
+	using result_t = detail::vector_of_operand<Operand>;
+	if constexpr (result_t::is_dynamic()) {
+		result_t out(aml::size_initializer(operand.size()), aml::uninitialized);
+		aml::assign(policy, out, operand);
+		return out;
+	} else {
+		return result_t(operand);
+	}
+}
+
+/**
+	@brief Parallel aml::add(). @f$ \vec{out} = \vec{a} + \vec{b} @f$
+*/
+template<class Policy, class Out, class Left, class Right,
+	std::enable_if_t<detail::is_execution_policy<Policy> && detail::is_vector_operand<Out> && detail::is_vector_operand<Left> && detail::is_vector_operand<Right>, int> = 0
+>
+void add(const Policy& policy, Out&& out, const Left& left, const Right& right) noexcept {
+	aml::assign(policy, out, left + right);
+}
+
+/**
+	@brief Parallel aml::sub(). @f$ \vec{out} = \vec{a} - \vec{b} @f$
+*/
+template<class Policy, class Out, class Left, class Right,
+	std::enable_if_t<detail::is_execution_policy<Policy> && detail::is_vector_operand<Out> && detail::is_vector_operand<Left> && detail::is_vector_operand<Right>, int> = 0
+>
+void sub(const Policy& policy, Out&& out, const Left& left, const Right& right) noexcept {
+	aml::assign(policy, out, left - right);
+}
+
+/**
+	@brief Parallel aml::scale(). @f$ \vec{out} = s \vec{a} @f$
+*/
+template<class Policy, class Out, class Vec, class Scalar,
+	std::enable_if_t<detail::is_execution_policy<Policy> && detail::is_vector_operand<Out> && detail::is_vector_operand<Vec> && !detail::is_vector_operand<Scalar>, int> = 0
+>
+void scale(const Policy& policy, Out&& out, const Vec& vec, const Scalar& scalar) noexcept {
+	aml::assign(policy, out, vec * scalar);
+}
+
+/**
+	@brief Parallel aml::sum_of()
+	@details Serial if the size is less than #AML_PARALLEL_THRESHOLD.
+			 The compensated accumulator as @p OutType accumulates the sums of the chunks and adds them together
+*/
+template<class OutType = selectable_unused, class Policy, class Vec,
+	std::enable_if_t<detail::is_execution_policy<Policy> && detail::is_vector_operand<Vec>, int> = 0
+> [[nodiscard]]
+auto sum_of(const Policy& policy, const Vec& vec) noexcept
+{
+	using result_t = detail::reduction_type<OutType, aml::accumulation_type<aml::remove_cvref<decltype(vec.first())>>>;
+	const result_t out = detail::parallel_reduce<result_t>(policy, [](const auto& elem) {
+		return elem;
+	}, vec, vec);
+
+	return aml::selectable_convert<OutType>(out);
+}
+
+/**
+	@brief Parallel aml::dist()
+	@details Serial if the size is less than #AML_PARALLEL_THRESHOLD
+*/
+template<class OutType = selectable_unused, class Policy, class Vec,
+	std::enable_if_t<detail::is_execution_policy<Policy> && detail::is_vector_operand<Vec>, int> = 0
+> [[nodiscard]]
+auto dist(const Policy& policy, const Vec& vec) noexcept
+{
+	using result_t = aml::common_type<float, aml::value_type_of<decltype(vec)>>;
+	const result_t out = detail::parallel_reduce<result_t>(policy, [](const auto& elem) {
+		return aml::sqr(elem);
+	}, vec, vec);
+
+	return aml::selectable_convert<OutType>(aml::sqrt(out));
+}
+
+/**
+	@brief Parallel aml::normalize()
+	@details The dynamic vector is evaluated into the new vector
+*/
+template<class Policy, class Vec,
+	std::enable_if_t<detail::is_execution_policy<Policy> && detail::is_vector_operand<Vec>, int> = 0
+> [[nodiscard]]
+auto normalize(const Policy& policy, const Vec& vec)
+{
+	if constexpr (!detail::vector_of_operand<Vec>::is_dynamic()) {
+		return aml::normalize(vec);
+	} else {
+		using disttype = decltype(aml::dist(policy, vec));
+
+		const disttype inv_mag = static_cast<disttype>(1) / aml::dist(policy, vec);
+		return aml::evaluate(policy, vec * inv_mag);
+	}
+}
+
+/**
+	@brief Checks if the vectors are equal on the threads of the pool
+	@details Same as <tt>left == right</tt>. Serial if the size is less than #AML_PARALLEL_THRESHOLD
+*/
+template<class Policy, class Left, class Right,
+	std::enable_if_t<detail::is_execution_policy<Policy> && detail::is_vector_operand<Left> && detail::is_vector_operand<Right>, int> = 0
+> [[nodiscard]]
+bool is_equal([[maybe_unused]] const Policy& policy, const Left& left, const Right& right) noexcept
+{
+	if (left.size() != right.size()) return false;
+
+	std::atomic<bool> equal{true};
+	detail::parallel_for(left.size(), [&](const Vectorsize begin, const Vectorsize end) {
+		if (!equal.load(std::memory_order_relaxed)) return;
+		if (!detail::equal_range<decltype(detail::lower_operand(left)), decltype(detail::lower_operand(right))>(
+				detail::lower_operand(left), detail::lower_operand(right), begin, end)) {
+			equal.store(false, std::memory_order_relaxed);
+		}
+	});
+	return equal.load(std::memory_order_relaxed);
+}
+
+}
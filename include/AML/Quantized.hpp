@@ -0,0 +1,494 @@
+/** @file */
+#pragma once
+
+#include <AML/Vector.hpp>
+#include <AML/Dispatch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifdef AML_LIBRARY
+	#define AML_LIBRARY_QUANTIZED
+#else
+	#error AML library is required
+#endif
+
+#if (defined(__AVX512VNNI__) && defined(__AVX512BW__)) || AML_DISPATCH_X86
+	#define AML_HAS_VNNI_CODE_KERNELS 1
+#else
+	#define AML_HAS_VNNI_CODE_KERNELS 0
+#endif
+
+#if defined(__AVX2__) || AML_DISPATCH_X86
+	#define AML_HAS_AVX2_CODE_KERNELS 1
+#else
+	#define AML_HAS_AVX2_CODE_KERNELS 0
+#endif
+
+#if AML_HAS_VNNI_CODE_KERNELS || AML_HAS_AVX2_CODE_KERNELS
+	#include <immintrin.h>
+#endif
+
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+	#define AML_TARGET_VNNI
+#elif AML_DISPATCH_X86
+	#define AML_TARGET_VNNI __attribute__((target("avx2,avx512f,avx512bw,avx512vl,avx512vnni")))
+#endif
+
+#if defined(__AVX2__)
+	#define AML_TARGET_CODES_AVX2
+#elif AML_DISPATCH_X86
+	#define AML_TARGET_CODES_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace aml
+{
+
+/**
+	@brief Parameters of the affine quantization: <tt>value = scale * (code - zero_point)</tt>
+*/
+struct quantization
+{
+	float scale = 1.f;
+	std::int32_t zero_point = 0;
+};
+
+/**
+	@brief Chooses the quantization which maps [min, max] of the @p count numbers from @p first to the whole range of @c std::int8_t
+	@details The range is extended to include zero, so zero is quantized exactly
+*/
+[[nodiscard]] inline
+aml::quantization choose_quantization(const float* const first, const std::size_t count) noexcept
+{
+	float min = 0.f;
+	float max = 0.f;
+	for (std::size_t i = 0; i < count; ++i) {
+		min = (std::min)(min, first[i]);
+		max = (std::max)(max, first[i]);
+	}
+
+	aml::quantization out;
+	out.scale = (max > min) ? (max - min) / 255.f : 1.f;
+	out.zero_point = static_cast<std::int32_t>(std::lround(-128.f - min / out.scale));
+	out.zero_point = (std::clamp)(out.zero_point, std::int32_t{-128}, std::int32_t{127});
+	return out;
+}
+
+/**
+	@brief Quantizes @p count numbers from @p first into @p out, rounding to the nearest even and saturating
+	@details With SSE2 16 numbers are converted at once and packed with the saturation (@c packssdw, @c packsswb),
+			 the compilers pack the truncated integers element by element
+
+	@warning The numbers must not be NaN
+*/
+inline
+void quantize_n(const float* const first, const std::size_t count, const aml::quantization& params, std::int8_t* const out) noexcept
+{
+	const float inverse = 1.f / params.scale;
+	const float zero_point = static_cast<float>(params.zero_point);
+	std::size_t i = 0;
+#if AML_SSE2
+	const __m128 vinverse = _mm_set1_ps(inverse);
+	const __m128 vzero_point = _mm_set1_ps(zero_point);
+	const auto convert = [&](const std::size_t offset) {
+		// The saturation of the conversion gives INT_MIN for the large positive numbers, so they are clamped first
+		const __m128 code = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(first + offset), vinverse), vzero_point);
+		return _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(code, _mm_set1_ps(-128.f)), _mm_set1_ps(127.f)));
+	};
+	for (; (i + 16) <= count; i += 16) {
+		const __m128i low = _mm_packs_epi32(convert(i), convert(i + 4));
+		const __m128i high = _mm_packs_epi32(convert(i + 8), convert(i + 12));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi16(low, high));
+	}
+#endif
+	for (; i < count; ++i) {
+		// Rounds by the rounding mode like cvtps2dq, the nearest even unless the program changes it
+		float code = std::nearbyint(first[i] * inverse + zero_point);
+		code = (code < -128.f) ? -128.f : code;
+		code = (code > 127.f) ? 127.f : code;
+		out[i] = static_cast<std::int8_t>(static_cast<std::int32_t>(code));
+	}
+}
+
+/**
+	@brief Converts @p count codes from @p first back to @c float into @p out
+*/
+inline
+void dequantize_n(const std::int8_t* const first, const std::size_t count, const aml::quantization& params, float* const out) noexcept
+{
+	for (std::size_t i = 0; i < count; ++i) {
+		out[i] = params.scale * static_cast<float>(static_cast<std::int32_t>(first[i]) - params.zero_point);
+	}
+}
+
+namespace detail
+{
+	/// The sums of the products are kept in @c std::int32_t within the blocks of the codes, so they can not overflow
+	inline constexpr std::size_t code_block = std::size_t{1} << 16;
+
+	inline
+	std::int64_t dot_codes_generic(const std::int8_t* const left, const std::int8_t* const right, const std::size_t count) noexcept
+	{
+		std::int64_t out = 0;
+		for (std::size_t block = 0; block < count; block += detail::code_block) {
+			const std::size_t end = (std::min)(count, block + detail::code_block);
+			std::int32_t acc = 0;
+			for (std::size_t i = block; i < end; ++i) {
+				acc += static_cast<std::int32_t>(left[i]) * static_cast<std::int32_t>(right[i]);
+			}
+			out += acc;
+		}
+		return out;
+	}
+
+#if AML_HAS_AVX2_CODE_KERNELS
+	AML_TARGET_CODES_AVX2 inline
+	__m256i load_codes_avx2(const std::int8_t* const ptr) noexcept {
+		return _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));
+	}
+
+	/// Sign-extends the codes to 16 bits and adds the pairs of the products with @c vpmaddwd
+	AML_TARGET_CODES_AVX2 inline
+	std::int64_t dot_codes_avx2(const std::int8_t* const left, const std::int8_t* const right, const std::size_t count) noexcept
+	{
+		std::int64_t out = 0;
+		std::size_t i = 0;
+		while ((i + 32) <= count) {
+			const std::size_t end = (std::min)(count, i + detail::code_block);
+			__m256i acc0 = _mm256_setzero_si256();
+			__m256i acc1 = _mm256_setzero_si256();
+			for (; (i + 32) <= end; i += 32) {
+				acc0 = _mm256_add_epi32(acc0, _mm256_madd_epi16(detail::load_codes_avx2(left + i), detail::load_codes_avx2(right + i)));
+				acc1 = _mm256_add_epi32(acc1, _mm256_madd_epi16(detail::load_codes_avx2(left + i + 16), detail::load_codes_avx2(right + i + 16)));
+			}
+			const __m256i acc = _mm256_add_epi32(acc0, acc1);
+			__m128i sum = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+			sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4e));
+			sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xb1));
+			out += _mm_cvtsi128_si32(sum);
+		}
+		return out + detail::dot_codes_generic(left + i, right + i, count - i);
+	}
+#endif
+
+#if AML_HAS_VNNI_CODE_KERNELS
+	/**
+		@brief Multiplies the unsigned and the signed bytes with @c vpdpbusd
+		@details @c vpdpbusd multiplies the unsigned bytes, so the sign bit of the @p left codes is flipped, which adds 128 to them,
+				 and <tt>128 * right_sum</tt> is subtracted at the end. The tail is loaded with the mask, the masked bytes are zeros
+	*/
+	AML_TARGET_VNNI inline
+	std::int64_t dot_codes_vnni(const std::int8_t* const left, const std::int8_t* const right, const std::size_t count, const std::int64_t right_sum) noexcept
+	{
+		const __m512i flip = _mm512_set1_epi8(static_cast<char>(0x80));
+
+		std::int64_t out = 0;
+		for (std::size_t block = 0; block < count; block += detail::code_block) {
+			const std::size_t end = (std::min)(count, block + detail::code_block);
+			__m512i acc0 = _mm512_setzero_si512();
+			__m512i acc1 = _mm512_setzero_si512();
+			std::size_t i = block;
+			for (; (i + 128) <= end; i += 128) {
+				acc0 = _mm512_dpbusd_epi32(acc0, _mm512_xor_si512(_mm512_loadu_si512(left + i), flip), _mm512_loadu_si512(right + i));
+				acc1 = _mm512_dpbusd_epi32(acc1, _mm512_xor_si512(_mm512_loadu_si512(left + i + 64), flip), _mm512_loadu_si512(right + i + 64));
+			}
+			for (; i < end; i += 64) {
+				const std::size_t rest = end - i;
+				const __mmask64 mask = (rest >= 64) ? ~__mmask64{0} : ((__mmask64{1} << rest) - 1);
+				const __m512i l = _mm512_xor_si512(_mm512_maskz_loadu_epi8(mask, left + i), flip);
+				acc0 = _mm512_dpbusd_epi32(acc0, l, _mm512_maskz_loadu_epi8(mask, right + i));
+			}
+			// Stored and added in the scalar code, the extraction of the halves warns about the undefined upper lanes in GCC
+			alignas(64) std::int32_t lanes[16];
+			_mm512_store_si512(lanes, _mm512_add_epi32(acc0, acc1));
+			std::int32_t sum = 0;
+			for (const std::int32_t lane : lanes) {
+				sum += lane;
+			}
+			out += sum;
+		}
+		return out - 128 * right_sum;
+	}
+#endif
+
+	inline
+	bool has_vnni_codes() noexcept
+	{
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+		return true;
+#elif AML_DISPATCH_X86
+		static const bool supported = (aml::active_isa() == aml::cpu_isa::avx512) && __builtin_cpu_supports("avx512vnni");
+		return supported;
+#else
+		return false;
+#endif
+	}
+
+	inline
+	bool has_avx2_codes() noexcept
+	{
+#if defined(__AVX2__)
+		return true;
+#elif AML_DISPATCH_X86
+		return (aml::active_isa() != aml::cpu_isa::sse2);
+#else
+		return false;
+#endif
+	}
+
+	/// The squares of the differences of the codes are at most 255^2, so the blocks are halved to keep their sums in @c std::int32_t
+	inline constexpr std::size_t code_difference_block = detail::code_block / 2;
+
+	inline
+	std::int64_t dist_codes_generic(const std::int8_t* const left, const std::int8_t* const right, const std::size_t count) noexcept
+	{
+		std::int64_t out = 0;
+		for (std::size_t block = 0; block < count; block += detail::code_difference_block) {
+			const std::size_t end = (std::min)(count, block + detail::code_difference_block);
+			std::int32_t acc = 0;
+			for (std::size_t i = block; i < end; ++i) {
+				const std::int32_t diff = static_cast<std::int32_t>(left[i]) - static_cast<std::int32_t>(right[i]);
+				acc += diff * diff;
+			}
+			out += acc;
+		}
+		return out;
+	}
+
+#if AML_HAS_AVX2_CODE_KERNELS
+	/// Subtracts the codes sign-extended to 16 bits and adds the pairs of the squares with @c vpmaddwd
+	AML_TARGET_CODES_AVX2 inline
+	std::int64_t dist_codes_avx2(const std::int8_t* const left, const std::int8_t* const right, const std::size_t count) noexcept
+	{
+		std::int64_t out = 0;
+		std::size_t i = 0;
+		while ((i + 32) <= count) {
+			const std::size_t end = (std::min)(count, i + detail::code_difference_block);
+			__m256i acc0 = _mm256_setzero_si256();
+			__m256i acc1 = _mm256_setzero_si256();
+			for (; (i + 32) <= end; i += 32) {
+				const __m256i diff0 = _mm256_sub_epi16(detail::load_codes_avx2(left + i), detail::load_codes_avx2(right + i));
+				const __m256i diff1 = _mm256_sub_epi16(detail::load_codes_avx2(left + i + 16), detail::load_codes_avx2(right + i + 16));
+				acc0 = _mm256_add_epi32(acc0, _mm256_madd_epi16(diff0, diff0));
+				acc1 = _mm256_add_epi32(acc1, _mm256_madd_epi16(diff1, diff1));
+			}
+			const __m256i acc = _mm256_add_epi32(acc0, acc1);
+			__m128i sum = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+			sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4e));
+			sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xb1));
+			out += _mm_cvtsi128_si32(sum);
+		}
+		return out + detail::dist_codes_generic(left + i, right + i, count - i);
+	}
+#endif
+
+	/**
+		@brief Exact sum of the squares of the differences of the codes
+		@details Uses AVX2 if the build enables it or #AML_CPU_DISPATCH finds it, otherwise the loop which the compiler vectorizes
+	*/
+	inline
+	std::int64_t dist_codes(const std::int8_t* const left, const std::int8_t* const right, const std::size_t count) noexcept
+	{
+#if AML_HAS_AVX2_CODE_KERNELS
+		if (detail::has_avx2_codes()) {
+			return detail::dist_codes_avx2(left, right, count);
+		}
+#endif
+		return detail::dist_codes_generic(left, right, count);
+	}
+
+	/**
+		@brief Exact sum of the products of the codes, @p right_sum is the sum of the @p right codes
+		@details Uses AVX-512 VNNI or AVX2 if the build enables them or #AML_CPU_DISPATCH finds them, otherwise the loop which the compiler vectorizes
+	*/
+	inline
+	std::int64_t dot_codes(const std::int8_t* const left, const std::int8_t* const right, const std::size_t count, const std::int64_t right_sum) noexcept
+	{
+#if AML_HAS_VNNI_CODE_KERNELS
+		if (detail::has_vnni_codes()) {
+			return detail::dot_codes_vnni(left, right, count, right_sum);
+		}
+#endif
+#if AML_HAS_AVX2_CODE_KERNELS
+		if (detail::has_avx2_codes()) {
+			return detail::dot_codes_avx2(left, right, count);
+		}
+#endif
+		(void)right_sum;
+		return detail::dot_codes_generic(left, right, count);
+	}
+}
+
+/**
+	@brief Vector of the @c std::int8_t codes with the scale and the zero point of the affine quantization
+	@details Quarters the memory and the memory traffic of aml::DVector<float>.
+			 The sum and the sum of the squares of the codes are computed once,
+			 so aml::quantized_dot and aml::quantized_cosine need a single pass of the integer kernel
+			 (detail::dot_codes) over the codes and give the same result on every instruction set.
+			 @n
+			 The error of a value is at most <tt>scale / 2</tt>
+
+	@see aml::quantize_n(), aml::dequantize_n(), aml::choose_quantization()
+*/
+class QuantizedVector
+{
+public:
+
+	using value_type	= float;
+	using code_type		= std::int8_t;
+	using size_type		= std::size_t;
+
+	QuantizedVector() = default;
+
+	/**
+		@brief Quantizes @p vec with the parameters chosen by aml::choose_quantization()
+	*/
+	explicit QuantizedVector(const aml::DVector<float>& vec)
+		: QuantizedVector(vec, aml::choose_quantization(vec.data(), vec.size())) {}
+
+	/**
+		@brief Quantizes @p vec with the given parameters, so the vectors can share the scale
+	*/
+	QuantizedVector(const aml::DVector<float>& vec, const aml::quantization& params)
+		: m_codes(vec.size()), m_params(params)
+	{
+		aml::quantize_n(vec.data(), vec.size(), params, m_codes.data());
+		for (const code_type code : m_codes) {
+			m_code_sum += code;
+		}
+		m_code_square_sum = detail::dot_codes(m_codes.data(), m_codes.data(), m_codes.size(), m_code_sum);
+	}
+
+	[[nodiscard]]
+	aml::DVector<float> dequantize() const
+	{
+		aml::DVector<float> out{aml::size_initializer(this->size())};
+		aml::dequantize_n(m_codes.data(), m_codes.size(), m_params, out.data());
+		return out;
+	}
+
+	/**
+		@return Returns the dequantized value of the element at @p index
+	*/
+	[[nodiscard]]
+	value_type operator[](const size_type index) const noexcept
+	{
+		AML_DEBUG_VERIFY(index < this->size(), "QuantizedVector index out of range | index: %zu", index);
+		return m_params.scale * static_cast<float>(static_cast<std::int32_t>(m_codes[index]) - m_params.zero_point);
+	}
+
+	[[nodiscard]] size_type size() const noexcept { return m_codes.size(); }
+	[[nodiscard]] bool empty() const noexcept { return m_codes.empty(); }
+
+	[[nodiscard]] const code_type* data() const noexcept { return m_codes.data(); }
+	[[nodiscard]] const aml::quantization& params() const noexcept { return m_params; }
+
+	/// Sum of the codes
+	[[nodiscard]] std::int64_t code_sum() const noexcept { return m_code_sum; }
+	/// Sum of the squares of the codes
+	[[nodiscard]] std::int64_t code_square_sum() const noexcept { return m_code_square_sum; }
+
+	/**
+		@brief Squared length of the dequantized vector
+	*/
+	[[nodiscard]]
+	double dist_squared() const noexcept
+	{
+		const double zero_point = m_params.zero_point;
+		const double codes = static_cast<double>(m_code_square_sum) - 2. * zero_point * static_cast<double>(m_code_sum)
+			+ static_cast<double>(this->size()) * zero_point * zero_point;
+		return static_cast<double>(m_params.scale) * m_params.scale * codes;
+	}
+
+private:
+	std::vector<code_type> m_codes;
+	aml::quantization m_params;
+	std::int64_t m_code_sum = 0;
+	std::int64_t m_code_square_sum = 0;
+};
+
+namespace detail
+{
+	inline
+	void verify_quantized_size([[maybe_unused]] const aml::QuantizedVector& left, [[maybe_unused]] const aml::QuantizedVector& right) noexcept {
+		AML_DEBUG_VERIFY(left.size() == right.size(),
+			"QuantizedVector's sizes must be equal | left size: %zu, right size: %zu", left.size(), right.size());
+	}
+
+	/**
+		@brief Dot product of the dequantized vectors in @c double
+		@details <tt>sum((l - zl) * (r - zr)) = sum(l * r) - zr * sum(l) - zl * sum(r) + n * zl * zr</tt>, the sums are exact integers
+	*/
+	inline
+	double quantized_dot(const aml::QuantizedVector& left, const aml::QuantizedVector& right) noexcept
+	{
+		const std::int64_t products = detail::dot_codes(left.data(), right.data(), left.size(), right.code_sum());
+		const double left_zero = left.params().zero_point;
+		const double right_zero = right.params().zero_point;
+		const double codes = static_cast<double>(products) - right_zero * static_cast<double>(left.code_sum())
+			- left_zero * static_cast<double>(right.code_sum()) + static_cast<double>(left.size()) * left_zero * right_zero;
+		return static_cast<double>(left.params().scale) * right.params().scale * codes;
+	}
+}
+
+/**
+	@brief Dot product of the quantized vectors computed with the integer kernel
+	@details The result is exactly the dot product of the dequantized values, rounded to @c float
+
+	@note The sizes of the vectors must be equal
+*/
+[[nodiscard]] inline
+float quantized_dot(const aml::QuantizedVector& left, const aml::QuantizedVector& right) noexcept
+{
+	detail::verify_quantized_size(left, right);
+	return static_cast<float>(detail::quantized_dot(left, right));
+}
+
+/**
+	@brief Squared distance between the quantized vectors. @f$ || \vec{a} - \vec{b} ||^2 @f$
+	@details The differences are summed directly, not as @f$ || \vec{a} ||^2 + || \vec{b} ||^2 - 2 \vec{a} \cdot \vec{b} @f$, which cancels for the close vectors.
+			 The vectors with the same quantization parameters sum the squares of the differences of the codes exactly with the integer kernel (detail::dist_codes),
+			 others sum the differences of the dequantized values in @c double
+
+	@note The sizes of the vectors must be equal
+*/
+[[nodiscard]] inline
+float quantized_dist_squared(const aml::QuantizedVector& left, const aml::QuantizedVector& right) noexcept
+{
+	detail::verify_quantized_size(left, right);
+	const aml::quantization& lparams = left.params();
+	const aml::quantization& rparams = right.params();
+	if ((lparams.scale == rparams.scale) && (lparams.zero_point == rparams.zero_point)) {
+		const std::int64_t codes = detail::dist_codes(left.data(), right.data(), left.size());
+		return static_cast<float>(static_cast<double>(lparams.scale) * lparams.scale * static_cast<double>(codes));
+	}
+
+	// The products of the scales and the codes are exact in double
+	const double lscale = lparams.scale;
+	const double rscale = rparams.scale;
+	double out = 0.;
+	for (std::size_t i = 0; i < left.size(); ++i) {
+		const double diff = lscale * (left.data()[i] - lparams.zero_point) - rscale * (right.data()[i] - rparams.zero_point);
+		out += diff * diff;
+	}
+	return static_cast<float>(out);
+}
+
+/**
+	@brief Cosine of the angle between the quantized vectors. @f$ \frac{\vec{a} \cdot \vec{b}}{|| \vec{a} || \, || \vec{b} ||} @f$
+	@details Zero if any of the vectors is zero
+
+	@note The sizes of the vectors must be equal
+*/
+[[nodiscard]] inline
+float quantized_cosine(const aml::QuantizedVector& left, const aml::QuantizedVector& right) noexcept
+{
+	detail::verify_quantized_size(left, right);
+	const double norms = std::sqrt(left.dist_squared() * right.dist_squared());
+	return (norms > 0.) ? static_cast<float>(detail::quantized_dot(left, right) / norms) : 0.f;
+}
+
+}
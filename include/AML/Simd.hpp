@@ -0,0 +1,213 @@
+/** @file */
+#pragma once
+
+#include <AML/_AMLCore.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#if defined(AML_SIMD_VECTOR) && AML_SSE2
+	#include <immintrin.h>
+#endif
+
+#ifdef AML_LIBRARY
+	#define AML_LIBRARY_SIMD
+#else
+	#error AML library is required
+#endif
+
+//#define AML_SIMD_VECTOR
+
+namespace aml
+{
+
+namespace detail
+{
+	/**
+		@brief Checks if the vector with the element type @p T and the size @p Size uses SIMD storage
+		@details SIMD storage is enabled by the @c AML_SIMD_VECTOR macro for @c float and @c double vectors with size from 2 to 4
+	*/
+	template<class T, std::size_t Size>
+	inline constexpr bool is_simd_storage =
+#if defined(AML_SIMD_VECTOR) && AML_SSE2
+		(std::is_same_v<T, float> && (Size >= 2) && (Size <= 4)) ||
+		(std::is_same_v<T, double> && (Size == 2)) ||
+		(std::is_same_v<T, double> && (Size >= 3) && (Size <= 4) && AML_AVX);
+#else
+		false;
+#endif
+
+	/**
+		@brief Alignment of the vector storage
+		@details The natural alignment of the element if the vector does not use SIMD storage. 
+				 The size 3 vectors are aligned as the size 4 vectors, so they are padded to the full register
+	*/
+	template<class T, std::size_t Size>
+	inline constexpr std::size_t simd_storage_alignment =
+		is_simd_storage<T, Size> ? ((Size == 3) ? (4 * sizeof(T)) : (Size * sizeof(T))) 
+			: alignof(std::conditional_t<std::is_reference_v<T>, std::remove_reference_t<T>*, T>);
+
+#if defined(AML_SIMD_VECTOR) && AML_SSE2
+namespace simd
+{
+	// vvvvv float vvvvv
+
+	inline
+	float hsum(const __m128 v) noexcept
+	{
+		const __m128 shuf = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+		const __m128 sums = _mm_add_ps(v, shuf);
+		return _mm_cvtss_f32(_mm_add_ss(sums, _mm_movehl_ps(shuf, sums)));
+	}
+
+	template<std::size_t Size> AML_FORCEINLINE
+	__m128 load(const float* const p) noexcept
+	{
+		if constexpr (Size == 2) {
+			return _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(p)));
+		} else if constexpr (Size == 3) {
+			// The fourth lane is the padding of the storage
+			return _mm_and_ps(_mm_load_ps(p), _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+		} else {
+			return _mm_load_ps(p);
+		}
+	}
+
+	template<std::size_t Size> AML_FORCEINLINE
+	void store(float* const p, const __m128 v) noexcept
+	{
+		if constexpr (Size == 2) {
+			_mm_store_sd(reinterpret_cast<double*>(p), _mm_castps_pd(v));
+		} else {
+			_mm_store_ps(p, v);
+		}
+	}
+
+	template<std::size_t Size> AML_FORCEINLINE
+	float dot(const float* const a, const float* const b) noexcept
+	{
+#if AML_SSE41
+		return _mm_cvtss_f32(_mm_dp_ps(load<Size>(a), load<Size>(b), 0xF1));
+#else
+		return simd::hsum(_mm_mul_ps(load<Size>(a), load<Size>(b)));
+#endif
+	}
+
+	inline
+	__m128 cross(const __m128 a, const __m128 b) noexcept
+	{
+		const __m128 a_yzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 b_yzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 c = _mm_sub_ps(_mm_mul_ps(a, b_yzx), _mm_mul_ps(a_yzx, b));
+		return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+	}
+
+	template<std::size_t Size> AML_FORCEINLINE
+	void normalize(float* const out, const float* const v) noexcept
+	{
+		const __m128 a = load<Size>(v);
+		const __m128 inv_mag = _mm_div_ss(_mm_set_ss(1.f), _mm_sqrt_ss(_mm_set_ss(simd::dot<Size>(v, v))));
+		store<Size>(out, _mm_mul_ps(a, _mm_shuffle_ps(inv_mag, inv_mag, 0)));
+	}
+
+	// vvvvv double vvvvv
+
+	template<std::size_t Size> AML_FORCEINLINE
+	double dot(const double* const a, const double* const b) noexcept
+	{
+		if constexpr (Size == 2) {
+#if AML_SSE41
+			return _mm_cvtsd_f64(_mm_dp_pd(_mm_load_pd(a), _mm_load_pd(b), 0x31));
+#else
+			const __m128d p = _mm_mul_pd(_mm_load_pd(a), _mm_load_pd(b));
+			return _mm_cvtsd_f64(_mm_add_sd(p, _mm_unpackhi_pd(p, p)));
+#endif
+		}
+#if AML_AVX
+		else {
+			__m256d p = _mm256_mul_pd(_mm256_load_pd(a), _mm256_load_pd(b));
+			if constexpr (Size == 3) {
+				p = _mm256_blend_pd(_mm256_setzero_pd(), p, 0b0111);
+			}
+			const __m128d s = _mm_add_pd(_mm256_castpd256_pd128(p), _mm256_extractf128_pd(p, 1));
+			return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+		}
+#endif
+	}
+
+	template<std::size_t Size> AML_FORCEINLINE
+	void normalize(double* const out, const double* const v) noexcept
+	{
+		const double inv_mag = 1. / _mm_cvtsd_f64(_mm_sqrt_sd(_mm_setzero_pd(), _mm_set_sd(simd::dot<Size>(v, v))));
+		if constexpr (Size == 2) {
+			_mm_store_pd(out, _mm_mul_pd(_mm_load_pd(v), _mm_set1_pd(inv_mag)));
+		}
+#if AML_AVX
+		else {
+			_mm256_store_pd(out, _mm256_mul_pd(_mm256_load_pd(v), _mm256_set1_pd(inv_mag)));
+		}
+#endif
+	}
+
+	// vvvvv vector interface vvvvv
+
+	/**
+		@brief Pointer to the first element of the vector with SIMD storage
+		@details The elements are the named fields or the array of @c AML_CONTIGUOUS_VECTOR
+	*/
+	template<class Vec> AML_FORCEINLINE
+	auto* data(Vec& vec) noexcept {
+		return std::addressof(vec[std::size_t{0}]);
+	}
+
+	/**
+		@brief Dot product of the vectors with SIMD storage
+	*/
+	template<class Vec> AML_FORCEINLINE
+	auto dot(const Vec& left, const Vec& right) noexcept {
+		return simd::dot<Vec::static_size>(simd::data(left), simd::data(right));
+	}
+
+	/**
+		@brief Length of the vector with SIMD storage
+	*/
+	template<class Vec> AML_FORCEINLINE
+	auto dist(const Vec& vec) noexcept
+	{
+		using value_type = typename Vec::value_type;
+		if constexpr (std::is_same_v<value_type, float>) {
+			return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(simd::dot(vec, vec))));
+		} else {
+			return _mm_cvtsd_f64(_mm_sqrt_sd(_mm_setzero_pd(), _mm_set_sd(simd::dot(vec, vec))));
+		}
+	}
+
+	/**
+		@brief Normalizes the vector with SIMD storage
+	*/
+	template<class Vec> AML_FORCEINLINE
+	Vec normalize(const Vec& vec) noexcept
+	{
+		Vec out;
+		simd::normalize<Vec::static_size>(simd::data(out), simd::data(vec));
+		return out;
+	}
+
+	/**
+		@brief Cross product of the @c float vectors with SIMD storage
+	*/
+	template<class Vec> AML_FORCEINLINE
+	Vec cross(const Vec& left, const Vec& right) noexcept
+	{
+		Vec out;
+		store<3>(simd::data(out), simd::cross(load<3>(simd::data(left)), load<3>(simd::data(right))));
+		return out;
+	}
+
+} // namespace simd
+#endif // defined(AML_SIMD_VECTOR) && AML_SSE2
+
+} // namespace detail
+
+} // namespace aml
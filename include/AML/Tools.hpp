@@ -118,6 +118,18 @@ struct fill_initializer
 	const value_type value;
 };
 
+/// Type of @ref uninitialized
+struct uninitialized_t {
+	explicit uninitialized_t() = default;
+};
+
+/**
+	@brief Tag that requests the container without initialized elements
+	@details Used when every element will be overwritten. 
+			 Only containers with the allocator that default-initializes elements (#aml::default_init_allocator) skip the initialization
+*/
+inline constexpr uninitialized_t uninitialized{};
+
 /// @cond
 
 /// Type of @ref zero
@@ -672,6 +684,30 @@ namespace detail
 template<class... Ts>
 using common_type = typename detail::template common_type_impl<Ts...>::type;
 
+/**
+	@brief Type in which the sums of the @p T elements are accumulated, @p T by default
+	@details Specialized by the element types which compute in a wider type (aml::float16, aml::bfloat16)
+*/
+template<class T>
+struct accumulation_type_body
+{
+	using type = T;
+};
+
+template<class T>
+using accumulation_type = typename accumulation_type_body<T>::type;
+
+/**
+	@brief Checks if @p T is the compensated accumulator (aml::double_double), false by default
+	@details aml::dot and aml::sum_of accumulate in the compensated accumulator given as their @c OutType.
+			 @p T must have the static function <tt>T::product(left, right)</tt>, which gives the product of the elements in @p T
+*/
+template<class T>
+struct is_compensated_accumulator_body : std::false_type {};
+
+template<class T>
+inline constexpr bool is_compensated_accumulator = is_compensated_accumulator_body<T>::value;
+
 namespace detail
 {
 	template<typename From, typename To, typename = void>
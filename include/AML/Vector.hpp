@@ -4,6 +4,9 @@
 #include <AML/Iterator.hpp>
 #include <AML/Tools.hpp>
 #include <AML/MathFunctions.hpp>
+#include <AML/Simd.hpp>
+#include <AML/Dispatch.hpp>
+#include <AML/Conversions.hpp>
 
 #include <cstddef>
 #include <type_traits>
@@ -13,12 +16,20 @@
 #include <array>
 #include <cstddef>
 #include <string>
+#include <tuple>
+#include <iterator>
+#include <memory>
+#include <cstdint>
 
 #if AML_CXX20
 #include <concepts>
 #include <span>
 #endif
 
+#if AML_SSE2
+	#include <emmintrin.h>
+#endif
+
 #ifdef AML_LIBRARY
 	#define AML_LIBRARY_VECTOR
 #else
@@ -26,6 +37,92 @@
 #endif
 
 //#define AML_PACK_VECTOR
+//#define AML_CONTIGUOUS_VECTOR
+
+/**
+	@brief Max size of the static vector whose operations are unrolled at compile time
+	@details The operations on larger static vectors use the runtime loop with a constant trip count, 
+			 which the compiler vectorizes and unrolls partially instead of instantiating a call per element
+*/
+#ifndef AML_VECTOR_UNROLL_MAX
+	#define AML_VECTOR_UNROLL_MAX 16
+#endif
+
+/**
+	@brief Number of independent accumulators of the reductions over the arithmetic vectors
+	@details The accumulators break the loop-carried dependency of the sum, so the compiler can keep them in the SIMD register
+*/
+#ifndef AML_REDUCTION_LANES
+	#define AML_REDUCTION_LANES 8
+#endif
+
+/**
+	@brief Max size of the dynamic vector whose reductions are dispatched by the runtime size to the unrolled kernels
+	@details aml::dot, aml::sum_of, aml::dist and aml::normalize of the dynamic arithmetic vectors with the size from 2 to #AML_SMALL_SIZE_DISPATCH 
+			 run the sum instantiated for that constant size, which is unrolled like the sum of the static vector and adds the elements in the same order as the loop.
+			 The compiler can contract the unrolled sum and the loop into FMA differently, so the last bits of the results can differ.
+			 The sizes from #AML_REDUCTION_LANES are summed in the lanes, which the unrolling does not speed up, 
+			 and the element-wise loops are vectorized with the runtime size as well as with the constant one. 0 disables the dispatch
+*/
+#ifndef AML_SMALL_SIZE_DISPATCH
+	#define AML_SMALL_SIZE_DISPATCH (AML_REDUCTION_LANES - 1)
+#endif
+
+/**
+	@brief Enables the pairwise summation in aml::dot, aml::sum_of and aml::dist of the arithmetic vectors
+	@details The vector is halved recursively down to the blocks of #AML_PAIRWISE_BLOCK elements, which are summed in #AML_REDUCTION_LANES lanes.
+			 The rounding error grows as @f$ O(\log n) @f$ instead of @f$ O(n) @f$ at nearly the same speed
+*/
+//#define AML_PAIRWISE_REDUCTION
+
+/**
+	@brief Number of the elements which are converted at once by the reductions over the elements with the bulk conversion
+	@details aml::float16 and aml::bfloat16 are converted to @c float on the stack by aml::convert_n(), then summed
+*/
+#ifndef AML_CONVERSION_BLOCK
+	#define AML_CONVERSION_BLOCK 256
+#endif
+
+/// Size of the block that is summed directly by the pairwise summation
+#ifndef AML_PAIRWISE_BLOCK
+	#define AML_PAIRWISE_BLOCK 512
+#endif
+
+/**
+	@brief Makes aml::dot, aml::sum_of and aml::dist of the arithmetic vectors bit-reproducible
+	@details The vector is split into the fixed blocks of #AML_DETERMINISTIC_BLOCK elements, 
+			 the block sums are added in the pairwise tree whose shape depends only on the size of the vector.
+			 The result is the same for the serial call and for any number of threads of aml::par.
+			 The lanes of the blocks are fixed by #AML_REDUCTION_LANES, so it does not depend on the SIMD width either
+	@note The compilers contract the multiplication and addition into FMA on the targets with FMA, which changes the rounding.
+		  Use <tt>-ffp-contract=off</tt> to get the same results from the builds for different instruction sets
+*/
+//#define AML_DETERMINISTIC_REDUCTION
+
+/// Size of the block of the deterministic reduction
+#ifndef AML_DETERMINISTIC_BLOCK
+	#define AML_DETERMINISTIC_BLOCK 4096
+#endif
+
+/**
+	@brief Size in bytes of the output of the element-wise operation of the dynamic vectors from which it is written with the non-temporal stores
+	@details The non-temporal stores do not read the output into the cache before writing it, which saves a third of the memory traffic of <tt>out = a + b</tt>.
+			 The operands can be prefetched #AML_PREFETCH_DISTANCE bytes ahead.
+			 The output is not in the cache afterwards, so the threshold must be greater than the last level cache. 0 disables the non-temporal stores
+	@note Requires SSE2
+*/
+#ifndef AML_STREAMING_THRESHOLD
+	#define AML_STREAMING_THRESHOLD (128 * 1024 * 1024)
+#endif
+
+/**
+	@brief Distance in bytes of the software prefetch of the operands of the outputs which are written with the non-temporal stores
+	@details 0 disables the software prefetch. The hardware prefetchers usually follow the sequential reads well, 
+			 so the prefetch helps only the processors which prefetch less than the memory latency ahead
+*/
+#ifndef AML_PREFETCH_DISTANCE
+	#define AML_PREFETCH_DISTANCE 0
+#endif
 
 namespace aml 
 {
@@ -38,6 +135,27 @@ namespace aml
 */
 using Vectorsize = std::size_t;
 
+template<class Result, class Operation, class... Operands>
+class VectorExpression;
+
+template<class T, Vectorsize Extent = aml::dynamic_extent>
+class VectorView;
+
+class parallel_policy;
+class parallel_unsequenced_policy;
+
+namespace detail
+{
+	template<class T>
+	void prefetch_operand(const T& operand, Vectorsize i) noexcept;
+
+	template<class Dst> constexpr
+	bool is_streaming_output(Vectorsize size) noexcept;
+
+	template<class Dst, class Value, class... Sources> constexpr
+	void write_range(Dst& dst, Value&& value, Vectorsize begin, Vectorsize end, bool streaming, const Sources&... sources) noexcept;
+}
+
 /**
 	@brief Namespace for compile-time vector indexes
 	@details Use them to access vector's fields from #Vector::operator[](const VI::index<I>) and #Vector::operator[](const VI::index<I>) const
@@ -72,17 +190,17 @@ namespace detail
 	};
 
 	template<class T>
-	struct VectorStorage<T, 2> {
+	struct alignas(detail::simd_storage_alignment<T, 2>) VectorStorage<T, 2> {
 		T x, y;
 	};
 
 	template<class T>
-	struct VectorStorage<T, 3> {
+	struct alignas(detail::simd_storage_alignment<T, 3>) VectorStorage<T, 3> {
 		T x, y, z;
 	};
 
 	template<class T>
-	struct VectorStorage<T, 4> {
+	struct alignas(detail::simd_storage_alignment<T, 4>) VectorStorage<T, 4> {
 		T x, y, z, w;
 	};
 
@@ -91,6 +209,38 @@ namespace detail
 		T x, y, z, w, v;
 	};
 
+	/**
+		@brief Checks if there is no padding between the named fields of the vector storage
+	*/
+	template<class T, Vectorsize Size> constexpr
+	bool has_contiguous_fields() noexcept
+	{
+		using storage_t = VectorStorage<T, Size>;
+		if constexpr ((Size > 5) || std::is_reference_v<T> || !std::is_standard_layout_v<storage_t>) {
+			return false;
+		} else {
+			bool out = true;
+			if constexpr (Size > 1) out = out && (offsetof(storage_t, y) == 1 * sizeof(T));
+			if constexpr (Size > 2) out = out && (offsetof(storage_t, z) == 2 * sizeof(T));
+			if constexpr (Size > 3) out = out && (offsetof(storage_t, w) == 3 * sizeof(T));
+			if constexpr (Size > 4) out = out && (offsetof(storage_t, v) == 4 * sizeof(T));
+			return out;
+		}
+	}
+
+	/**
+		@brief Checks if the named fields of the vector storage are iterated with raw pointers
+		@details Enabled by the @c AML_CONTIGUOUS_VECTOR macro for the vectors with size from 1 to 5.
+				 The named data members are kept, the vectors whose fields have padding between them are iterated by index
+	*/
+	template<class T, Vectorsize Size>
+	inline constexpr bool is_contiguous_named_storage =
+#ifdef AML_CONTIGUOUS_VECTOR
+		detail::has_contiguous_fields<T, Size>();
+#else
+		false;
+#endif
+
 	template<class T, Vectorsize Size>
 	struct VectorBase
 	{
@@ -106,6 +256,8 @@ namespace detail
 
 		static constexpr bool is_dynamic() noexcept						{ return (Size == aml::dynamic_extent); }
 		static constexpr bool uses_static_array() noexcept				{ return (Size > 5) && !is_dynamic(); }
+		static constexpr bool uses_simd_storage() noexcept				{ return detail::is_simd_storage<T, Size>; }
+		static constexpr bool uses_contiguous_storage() noexcept		{ return uses_static_array() || (!is_dynamic() && detail::is_contiguous_named_storage<T, Size>); }
 		static constexpr bool has_index(const size_type index) noexcept { return (Size > index); }
 
 		static constexpr Vectorsize extent = aml::dynamic_extent;
@@ -115,6 +267,8 @@ namespace detail
 	struct VectorBase<T&, Size> : VectorBase<T, Size>
 	{
 		using value_type = std::reference_wrapper<T>;
+
+		static constexpr bool uses_contiguous_storage() noexcept		{ return false; }
 	};
 
 } // namespace detail
@@ -149,6 +303,59 @@ namespace detail
 	&& !aml::is_narrowing_conversion<typename Container::size_type, Vectorsize>;
 #endif // AML_CXX20
 
+namespace detail
+{
+	template<class Container, class = void>
+	struct is_contiguous_container_impl : std::false_type {};
+
+	template<class Container>
+	struct is_contiguous_container_impl<Container, std::void_t<decltype(std::declval<Container&>().data()), typename Container::iterator>>
+		: std::bool_constant<std::is_pointer_v<decltype(std::declval<Container&>().data())> &&
+#if AML_CXX20
+			std::contiguous_iterator<typename Container::iterator>
+#else
+			std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<typename Container::iterator>::iterator_category>
+#endif
+		> {};
+}
+
+/**
+	@brief Checks if the @p Container stores its elements contiguously
+	@details The container must have @c data() that returns a pointer and contiguous iterators (random access iterators before C++20). 
+			 The operations with dynamic vectors over such containers run on raw pointers, 
+			 other containers (@c std::deque, @c std::list) use the indexed access
+
+	@see aml::Vector<Container, dynamic_extent>::data()
+*/
+template<class Container>
+inline constexpr bool is_contiguous_container = detail::is_contiguous_container_impl<Container>::value;
+
+namespace detail
+{
+	template<class From, class To, class = void>
+	struct has_bulk_conversion_to : std::false_type {};
+
+	/// aml::convert_n() or the overload found by ADL
+	template<class From, class To>
+	struct has_bulk_conversion_to<From, To, std::void_t<decltype(convert_n(std::declval<const From*>(), std::size_t{}, std::declval<To*>()))>>
+		: std::true_type {};
+
+	/**
+		@brief Converts the elements by the bulk conversion, the constant evaluation casts them one by one
+	*/
+	template<class From, class To> constexpr
+	void convert_elements(const From* const first, const std::size_t count, To* const out) noexcept
+	{
+		if (!AML_IS_CONSTANT_EVALUATED()) {
+			convert_n(first, count, out);
+			return;
+		}
+		for (std::size_t i = 0; i < count; ++i) {
+			out[i] = static_cast<To>(first[i]);
+		}
+	}
+}
+
 /**
 	@brief The representation of a vector from linear algebra as a statically allocated template class
 
@@ -182,10 +389,10 @@ public:
 	
 #ifndef AML_PACK_VECTOR
 	/// The return type of the non-const begin() and end() methods
-	using iterator			= std::conditional_t<Base::uses_static_array(),		  value_type*,	   aml::IndexIterator<Vector<value_type, Size>>>;
+	using iterator			= std::conditional_t<Base::uses_contiguous_storage(),		  value_type*,	   aml::IndexIterator<Vector<value_type, Size>>>;
 
 	/// The return type of the const begin(), cbegin() and end(), cend() methods
-	using const_iterator	= std::conditional_t<Base::uses_static_array(), const value_type*, aml::ConstIndexIterator<Vector<value_type, Size>>>;
+	using const_iterator	= std::conditional_t<Base::uses_contiguous_storage(), const value_type*, aml::ConstIndexIterator<Vector<value_type, Size>>>;
 #else
 	using iterator = value_type*;
 	using const_iterator = const value_type*;
@@ -342,6 +549,21 @@ public:
 		});
 	}
 
+	/**
+		@brief Evaluates the vector expression into the vector
+
+		@warning The size of the expression must be the same as the size of the current vector
+
+		@see aml::VectorExpression
+	*/
+	template<class Result, class Operation, class... Operands> constexpr
+	explicit Vector(const VectorExpression<Result, Operation, Operands...>& expr) AML_NOEXCEPT(std::is_nothrow_copy_assignable_v<value_type>) {
+		AML_DEBUG_VERIFY(expr.size() == Size, "The vector expression must have the same size");
+		aml::static_for<Size>([&](const auto i) {
+			(*this)[i] = static_cast<value_type>(expr[i]);
+		});
+	}
+
 	constexpr
 	Vector(const Vector&) AML_NOEXCEPT(std::is_nothrow_copy_constructible_v<value_type>) = default;
 
@@ -536,6 +758,30 @@ public:
 		return const_cast<Vector&>(*this)[index];
 	}
 
+	/**
+		@brief Pointer to the first element
+		@details Exists if the elements are stored contiguously: for the vectors with size greater than 5, 
+				 or for all static vectors if the @c AML_CONTIGUOUS_VECTOR macro is defined. 
+				 In that case begin() and end() are also raw pointers, so the standard algorithms can use @c memcpy and SIMD
+
+		@warning The pointer to the named fields cannot be advanced in the constant evaluation
+	*/
+	template<bool Contiguous = Base::uses_contiguous_storage(), std::enable_if_t<Contiguous, int> = 0> [[nodiscard]] constexpr
+	value_type* data() noexcept
+	{
+		if constexpr (Base::uses_static_array()) {
+			return Storage::array;
+		} else {
+			static_assert(detail::has_contiguous_fields<T, Size>(), "The fields of the vector must be stored without padding");
+			return std::addressof(Storage::x);
+		}
+	}
+
+	template<bool Contiguous = Base::uses_contiguous_storage(), std::enable_if_t<Contiguous, int> = 0> [[nodiscard]] constexpr
+	const value_type* data() const noexcept {
+		return const_cast<Vector&>(*this).data();
+	}
+
 	/**
 		@return Begin #iterator
 	*/
@@ -543,6 +789,8 @@ public:
 	iterator begin() AML_NOEXCEPT(std::is_nothrow_constructible_v<iterator, decltype(*this), decltype(0)>) {
 		if constexpr (Base::uses_static_array()) {
 			return Storage::array;
+		} else if constexpr (Base::uses_contiguous_storage()) {
+			return this->data();
 		} else {
 #ifndef AML_PACK_VECTOR
 			return iterator(*this, 0);
@@ -559,6 +807,8 @@ public:
 	iterator end() AML_NOEXCEPT(std::is_nothrow_constructible_v<iterator, decltype(*this), decltype(size())>) {
 		if constexpr (Base::uses_static_array()) {
 			return Storage::array + this->size();
+		} else if constexpr (Base::uses_contiguous_storage()) {
+			return this->data() + this->size();
 		} else {
 #ifndef AML_PACK_VECTOR
 			return iterator(*this, this->size());
@@ -575,6 +825,8 @@ public:
 	const_iterator begin() const AML_NOEXCEPT(std::is_nothrow_constructible_v<const_iterator, decltype(*this), decltype(0)>) {
 		if constexpr (Base::uses_static_array()) {
 			return Storage::array;
+		} else if constexpr (Base::uses_contiguous_storage()) {
+			return this->data();
 		} else {
 #ifndef AML_PACK_VECTOR
 			return const_iterator(*this, 0);
@@ -591,6 +843,8 @@ public:
 	const_iterator end() const AML_NOEXCEPT(std::is_nothrow_constructible_v<const_iterator, decltype(*this), decltype(size())>) {
 		if constexpr (Base::uses_static_array()) {
 			return Storage::array + this->size();
+		} else if constexpr (Base::uses_contiguous_storage()) {
+			return this->data() + this->size();
 		} else {
 #ifndef AML_PACK_VECTOR
 			return const_iterator(*this, this->size());
@@ -801,6 +1055,18 @@ public:
 		this->resize(initsz.size);
 	}
 
+	/**
+		@brief Creates the vector with size, which elements will be overwritten
+		@details The elements are left uninitialized if the container allocator default-initializes them 
+				 (#aml::default_init_allocator), otherwise it is the same as Vector(const aml::size_initializer)
+
+		@see aml::uninitialized
+	*/
+	AML_CONSTEXPR20
+	explicit Vector(const aml::size_initializer initsz, [[maybe_unused]] const aml::uninitialized_t) AML_NOEXCEPT(noexcept(this->resize(initsz.size))) {
+		this->resize(initsz.size);
+	}
+
 	/**
 		@brief Creates the vector with size and fills it with 0
 
@@ -842,22 +1108,32 @@ public:
 	*/
 	AML_CONSTEXPR20
 	explicit Vector(const aml::size_initializer initsz, const aml::fill_initializer<value_type> fill_with) AML_NOEXCEPT(std::is_nothrow_constructible_v<Vector, decltype(initsz)> && noexcept(std::fill(this->container.begin(), this->container.end(), fill_with.value)))
-		: Vector(initsz) {
+		: Vector(initsz, aml::uninitialized) {
 		std::fill(this->container.begin(), this->container.end(), fill_with.value);
 	}
 
 	/**
 		@brief Cast from Vector<U, dynamic_extent> to Vector<T, dynamic_extent>
+		@details The contiguous vectors are converted by aml::convert_n(), 
+				 so the floating point numbers converted to the integers are truncated and saturated, NaN gives zero
 	*/
 	template<class U> AML_CONSTEXPR20
 	explicit Vector(const Vector<U, aml::dynamic_extent>& other) AML_NOEXCEPT(std::is_nothrow_copy_assignable_v<reference>)
-		: Vector(aml::size_initializer(other.size())) 
+		: Vector(aml::size_initializer(other.size()), aml::uninitialized) 
 	{
-		std::transform(other.cbegin(), other.cend(), this->begin(),
-			[](const auto& val) {
-				return static_cast<value_type>(val);
-			}
-		);
+		using other_type = Vector<U, aml::dynamic_extent>;
+		if constexpr (is_contiguous() && other_type::is_contiguous() && 
+			detail::has_bulk_conversion_to<typename other_type::value_type, value_type>::value) 
+		{
+			detail::convert_elements(other.data(), other.size(), this->data());
+		}
+		else {
+			std::transform(other.cbegin(), other.cend(), this->begin(),
+				[](const auto& val) {
+					return static_cast<value_type>(val);
+				}
+			);
+		}
 	}
 
 	/**
@@ -867,7 +1143,7 @@ public:
 	*/
 	template<class U, Vectorsize OtherSize> AML_CONSTEXPR20
 	explicit Vector(const Vector<U, OtherSize>& other) AML_NOEXCEPT(std::is_nothrow_copy_assignable_v<reference>)
-		: Vector(aml::size_initializer(other.static_size))
+		: Vector(aml::size_initializer(other.static_size), aml::uninitialized)
 	{
 		std::transform(other.cbegin(), other.cend(), this->container.begin(),
 			[](const auto& val) {
@@ -876,6 +1152,64 @@ public:
 		);
 	}
 
+	/**
+		@brief Evaluates the vector expression
+		@details Every element of the expression is computed once, in a single pass
+
+		@see aml::VectorExpression
+	*/
+	template<class Operation, class... Operands> AML_CONSTEXPR20
+	Vector(const VectorExpression<Vector, Operation, Operands...>& expr) AML_NOEXCEPT(std::is_nothrow_constructible_v<Vector, aml::size_initializer>)
+		: container(Vector::evaluate_container(expr)) {}
+
+	/**
+		@brief Evaluates the vector expression
+		@details Reuses the buffer of the moved vector if the expression owns one (<tt>std::move(a) + b</tt>)
+
+		@see aml::VectorExpression::evaluate() &&
+	*/
+	template<class Operation, class... Operands> AML_CONSTEXPR20
+	Vector(VectorExpression<Vector, Operation, Operands...>&& expr) AML_NOEXCEPT(std::is_nothrow_constructible_v<Vector, aml::size_initializer>)
+		: Vector(std::move(expr).evaluate()) {}
+
+	/**
+		@brief Evaluates the vector expression with a different result type
+	*/
+	template<class Result, class Operation, class... Operands, 
+		std::enable_if_t<!std::is_same_v<Result, Vector>, int> = 0
+	> AML_CONSTEXPR20
+	explicit Vector(const VectorExpression<Result, Operation, Operands...>& expr) AML_NOEXCEPT(std::is_nothrow_constructible_v<Vector, aml::size_initializer>)
+		: container(Vector::evaluate_container(expr)) {}
+
+private:
+
+	/**
+		@brief Creates the container from the expression writing every element once
+		@details Uses the iterator range constructor of the container if it exists, 
+				 so the buffer is not value-initialized before the evaluation. 
+				 The elements are read from the lowered expression
+
+		@see aml::VectorExpression::lower()
+	*/
+	template<class Expr> static AML_CONSTEXPR20
+	container_type evaluate_container(const Expr& expr)
+	{
+		using lowered_iterator = aml::ConstIndexIterator<decltype(expr.lower())>;
+		using difference_type = typename lowered_iterator::difference_type;
+
+		if constexpr (std::is_constructible_v<container_type, lowered_iterator, lowered_iterator>) {
+			const auto lowered = expr.lower();
+			return container_type(lowered_iterator(lowered, 0), lowered_iterator(lowered, static_cast<difference_type>(expr.size())));
+		} else {
+			container_type out;
+			out.resize(expr.size());
+			expr.evaluate_to(out);
+			return out;
+		}
+	}
+
+public:
+
 	AML_CONSTEXPR20
 	Vector(const Vector&) AML_NOEXCEPT(std::is_nothrow_copy_constructible_v<container_type>) = default;
 
@@ -888,6 +1222,31 @@ public:
 	AML_CONSTEXPR20
 	Vector& operator=(Vector&&) AML_NOEXCEPT(std::is_nothrow_move_assignable_v<container_type>) = default;
 
+	/**
+		@brief Evaluates the vector expression into the vector
+		@details The vector can be one of the expression operands (<tt>a = a + b</tt>)
+	*/
+	template<class Operation, class... Operands> AML_CONSTEXPR20
+	Vector& operator=(const VectorExpression<Vector, Operation, Operands...>& expr) AML_NOEXCEPT(noexcept(this->resize(expr.size()))) {
+		this->resize(expr.size());
+		expr.evaluate_to(*this);
+		return *this;
+	}
+
+	/**
+		@brief Evaluates the vector expression into the vector
+		@details Takes the buffer of the moved vector if the expression owns one (<tt>a = std::move(a) + b</tt>)
+	*/
+	template<class Operation, class... Operands> AML_CONSTEXPR20
+	Vector& operator=(VectorExpression<Vector, Operation, Operands...>&& expr) AML_NOEXCEPT(noexcept(this->resize(expr.size()))) {
+		if constexpr (VectorExpression<Vector, Operation, Operands...>::template can_reuse_buffer<Vector>()) {
+			*this = std::move(expr).evaluate();
+		} else {
+			*this = static_cast<const VectorExpression<Vector, Operation, Operands...>&>(expr);
+		}
+		return *this;
+	}
+
 	/**
 		@return Returns size of the vector
 	*/
@@ -1025,6 +1384,23 @@ public:
 		return std::move(this->container);
 	}
 
+	/**
+		@brief Checks if the container stores the elements contiguously
+
+		@see aml::is_contiguous_container
+	*/
+	[[nodiscard]] static constexpr
+	bool is_contiguous() noexcept { return aml::is_contiguous_container<container_type>; }
+
+	/**
+		@return Pointer to the first element of the contiguous container
+	*/
+	template<class C = container_type, std::enable_if_t<aml::is_contiguous_container<C>, int> = 0> [[nodiscard]] AML_CONSTEXPR20
+	auto data() noexcept { return this->container.data(); }
+
+	template<class C = container_type, std::enable_if_t<aml::is_contiguous_container<C>, int> = 0> [[nodiscard]] AML_CONSTEXPR20
+	auto data() const noexcept { return this->container.data(); }
+
 
 protected:
 	/**
@@ -1109,105 +1485,1016 @@ struct common_type_body<
 
 namespace detail
 {
-	template<class Left, Vectorsize LeftSize, class Right, Vectorsize RightSize> constexpr
-	void verify_vector_size(const Vector<Left, LeftSize>& left, const Vector<Right, RightSize>& right) noexcept
+	template<class T>
+	struct is_vector : std::false_type {};
+	template<class T, Vectorsize Size>
+	struct is_vector<aml::Vector<T, Size>> : std::true_type {};
+
+	template<class T>
+	struct is_vector_expression : std::false_type {};
+	template<class Result, class Operation, class... Operands>
+	struct is_vector_expression<aml::VectorExpression<Result, Operation, Operands...>> : std::true_type {};
+
+	template<class T>
+	inline constexpr bool is_vector_expression_v = is_vector_expression<aml::remove_cvref<T>>::value;
+
+	template<class T>
+	struct is_vector_view : std::false_type {};
+	template<class T, Vectorsize Extent>
+	struct is_vector_view<aml::VectorView<T, Extent>> : std::true_type {};
+
+	template<class T>
+	inline constexpr bool is_vector_view_v = is_vector_view<aml::remove_cvref<T>>::value;
+
+	/// Vector expression or vector view, which use the generic vector operators
+	template<class T>
+	inline constexpr bool is_lazy_operand = is_vector_expression_v<T> || is_vector_view_v<T>;
+
+	/// Checks if @p T is aml::parallel_policy or aml::parallel_unsequenced_policy
+	template<class T>
+	inline constexpr bool is_execution_policy = 
+		std::is_same_v<aml::remove_cvref<T>, aml::parallel_policy> || std::is_same_v<aml::remove_cvref<T>, aml::parallel_unsequenced_policy>;
+
+	/// Vector, vector expression or vector view
+	template<class T>
+	inline constexpr bool is_vector_operand = is_vector<aml::remove_cvref<T>>::value || is_lazy_operand<T>;
+
+	/// At least one of the operands is a vector expression or a vector view and the other one is any vector operand
+	template<class Left, class Right>
+	inline constexpr bool is_expression_operation = 
+		is_vector_operand<Left> && is_vector_operand<Right> && (is_lazy_operand<Left> || is_lazy_operand<Right>);
+
+	template<class T>
+	struct is_simd_vector : std::false_type {};
+	template<class T, Vectorsize Size>
+	struct is_simd_vector<aml::Vector<T, Size>> : std::bool_constant<aml::Vector<T, Size>::uses_simd_storage()> {};
+
+	/// Both operands are the same vector type with SIMD storage
+	template<class Left, class Right>
+	inline constexpr bool is_simd_operation = 
+		is_simd_vector<aml::remove_cvref<Left>>::value && std::is_same_v<aml::remove_cvref<Left>, aml::remove_cvref<Right>>;
+
+	template<class Expr, class Scalar>
+	inline constexpr bool is_expression_scalar_operation = is_lazy_operand<Expr> && !is_vector_operand<Scalar>;
+
+	template<class T>
+	struct vector_of_operand_impl { using type = T; };
+	template<class Result, class Operation, class... Operands>
+	struct vector_of_operand_impl<aml::VectorExpression<Result, Operation, Operands...>> { using type = Result; };
+	template<class T, Vectorsize Extent>
+	struct vector_of_operand_impl<aml::VectorView<T, Extent>> { 
+		using type = std::conditional_t<(Extent == aml::dynamic_extent), 
+			aml::Vector<std::vector<std::remove_const_t<T>>, aml::dynamic_extent>,
+			aml::Vector<std::remove_const_t<T>, Extent>
+		>;
+	};
+
+	/// Vector type produced by the vector operand
+	template<class T>
+	using vector_of_operand = typename vector_of_operand_impl<aml::remove_cvref<T>>::type;
+
+	template<class T>
+	struct is_dynamic_vector : std::false_type {};
+	template<class Container>
+	struct is_dynamic_vector<aml::Vector<Container, aml::dynamic_extent>> : std::true_type {};
+
+	/// Checks if @p T is the dynamic vector over the contiguous container
+	template<class T>
+	struct is_contiguous_vector : std::false_type {};
+	template<class Container>
+	struct is_contiguous_vector<aml::Vector<Container, aml::dynamic_extent>> : std::bool_constant<aml::is_contiguous_container<Container>> {};
+
+	/**
+		@brief The operand type of the expression
+		@details Rvalue dynamic vectors are marked as @c Vec&& and moved into the expression, 
+				 so their buffer can be reused for the result
+	*/
+	template<class T>
+	using expression_tag = std::conditional_t<
+		!std::is_lvalue_reference_v<T> && is_dynamic_vector<aml::remove_cvref<T>>::value && !std::is_const_v<std::remove_reference_t<T>>,
+		aml::remove_cvref<T>&&,
+		aml::remove_cvref<T>
+	>;
+
+	/// Vectors are held by reference, owned vectors, nested expressions and scalars are held by value
+	template<class T>
+	using expression_operand = std::conditional_t<is_vector<T>::value, const T&, std::remove_reference_t<T>>;
+
+	/// Checks if the expression operand @p T owns a vector of type @p Vec
+	template<class T, class Vec>
+	struct owns_vector : std::bool_constant<std::is_same_v<T, Vec&&>> {};
+	template<class Result, class Operation, class... Operands, class Vec>
+	struct owns_vector<aml::VectorExpression<Result, Operation, Operands...>, Vec> 
+		: std::bool_constant<(owns_vector<Operands, Vec>::value || ...)> {};
+
+	/**
+		@brief Guaranteed alignment of the elements of the contiguous dynamic vector
+		@details The @c alignment of the allocator of the container if it has one (aml::aligned_allocator), otherwise the alignment of the element
+	*/
+	template<class Vec, class = void>
+	inline constexpr std::size_t data_alignment = alignof(typename Vec::value_type);
+	template<class Vec>
+	inline constexpr std::size_t data_alignment<Vec, std::void_t<decltype(Vec::container_type::allocator_type::alignment)>> = 
+		Vec::container_type::allocator_type::alignment;
+
+	/**
+		@brief Tells the compiler that @p ptr is aligned to @p Align bytes, so the loops over it need no peeling
+	*/
+	template<std::size_t Align, class T> /** @cond */ AML_FORCEINLINE /** @endcond */ constexpr
+	T* assume_aligned(T* const ptr) noexcept
 	{
-		if constexpr (left.is_dynamic() || right.is_dynamic()) {
-			AML_DEBUG_VERIFY(left.size() == right.size(),
-				"Vector's sizes must be equal | left size: %zu, right size: %zu", left.size(), right.size());
-		} else {
-			static_assert(LeftSize == RightSize, "Vector's sizes must be equal");
+#if AML_GCC || AML_CLANG
+		if constexpr (Align > alignof(T)) {
+			if (!AML_IS_CONSTANT_EVALUATED()) {
+				return static_cast<T*>(__builtin_assume_aligned(ptr, Align));
+			}
 		}
+#endif
+		return ptr;
 	}
 
-	template<Vectorsize Start = 0, class Action, class Vec> constexpr
-	void iterate_vector(Action&& action, Vec&& vec) noexcept
+	/**
+		@brief Replaces the contiguous dynamic vector or the vector view with the pointer to its elements
+		@details Nested expressions are lowered recursively, other operands are returned as is. 
+				 Loops over the lowered operands are free from the container's indexing and can be vectorized.
+				 The pointer to the elements of the vector with aml::aligned_allocator carries its alignment
+
+		@see detail::data_alignment
+	*/
+	template<class T> constexpr
+	decltype(auto) lower_operand(const T& operand) noexcept
 	{
-		if constexpr (vec.is_dynamic()) {
-			for (Vectorsize i = Start; i < vec.size(); ++i) {
-				action(i);
-			}
+		if constexpr (is_contiguous_vector<T>::value) {
+			return detail::assume_aligned<data_alignment<T>>(operand.data());
+		} else if constexpr (is_vector_view<T>::value) {
+			return operand.data();
+		} else if constexpr (is_vector_expression<T>::value) {
+			return operand.lower();
 		} else {
-			aml::static_for<Start, vec.static_size>(action);
+			return (operand);
 		}
 	}
 
-	template<class Result, bool is_dynamic, class Action, class Left> constexpr
-	Result apply_vector_operation(Action&& action, Left&& left) noexcept
+	/// The writable counterpart of lower_operand()
+	template<class T> constexpr
+	decltype(auto) lower_output(T& out) noexcept
 	{
-		auto out = [&]() {
-			if constexpr (is_dynamic) { return Result{left.size()}; }
-			else { return Result{}; }
-		}();
+		if constexpr (is_contiguous_vector<std::remove_const_t<T>>::value) {
+			return detail::assume_aligned<data_alignment<std::remove_const_t<T>>>(out.data());
+		} else if constexpr (is_vector_view<std::remove_const_t<T>>::value) {
+			return out.data();
+		} else {
+			return (out);
+		}
+	}
 
-		iterate_vector([&](const auto i) {
-			out[i] = action(i);
-		}, left);
+	/// The operand type of the lowered expression
+	template<class T>
+	using lowered_operand = aml::remove_cvref<decltype(detail::lower_operand(std::declval<const aml::remove_cvref<T>&>()))>;
 
-		return out;
+	template<class T> constexpr
+	decltype(auto) expression_element(const T& operand, const Vectorsize i) noexcept
+	{
+		if constexpr (is_vector_operand<T> || std::is_pointer_v<T>) {
+			return operand[i];
+		} else {
+			return (operand);
+		}
 	}
 
-	template<class Operation, class Left, Vectorsize LeftSize, class Right, Vectorsize RightSize> constexpr
-	auto do_vector_operation(const Vector<Left, LeftSize>& left, const Vector<Right, RightSize>& right) noexcept
-	{
-		verify_vector_size(left, right);
-		using result_t = aml::rebind<
-			aml::common_type<aml::remove_cvref<decltype(left)>, aml::remove_cvref<decltype(right)>>,
-			aml::remove_cvref<decltype(Operation{}(left[0], right[0]))>
-		>;
-		return apply_vector_operation<
-			result_t,
-			left.is_dynamic() || right.is_dynamic()
-		>([&](const auto i) {
-			return Operation{}(left[i], right[i]);
-		}, aml::constexpr_ternary<left.is_dynamic()>(right, left));
-	}
-	template<class Operation, bool swap_order, class Left, Vectorsize LeftSize, class Right> constexpr
-	auto do_vector_operation(const Vector<Left, LeftSize>& left, const Right& right) noexcept
+	template<class First, class... Rest> constexpr
+	Vectorsize operand_size(const First& first, const Rest&... rest) noexcept
 	{
-		using result_t = aml::rebind<aml::remove_cvref<decltype(left)>, 
-			aml::common_type<
-				typename aml::remove_cvref<decltype(left)>::value_type, 
-				aml::remove_cvref<decltype(right)>
-			>
-		>;
-		return apply_vector_operation<
-			result_t,
-			left.is_dynamic()
-		>([&](const auto i) {
-			if constexpr (swap_order) {
-				return Operation{}(right, left[i]);
-			} else {
-				return Operation{}(left[i], right);
-			}
-		}, left);
+		if constexpr (is_vector_operand<First>) {
+			return first.size();
+		} else {
+			return detail::operand_size(rest...);
+		}
+	}
+}
+
+/**
+	@brief Lazy element-wise operation over vectors
+	@details Returned from the operations with dynamic vectors. 
+			 Nothing is computed until the expression is assigned or converted to the vector, 
+			 so chained operations (<tt>a + b * s - c</tt>) are evaluated in a single pass without temporary vectors
+
+	@warning The expression holds references to the vector operands, so it must not outlive them
+
+	@tparam Result The vector type which the expression evaluates to
+	@tparam Operation Element-wise functor
+	@tparam Operands Vectors, vector expressions or scalars
+*/
+template<class Result, class Operation, class... Operands>
+class VectorExpression
+{
+public:
+	using result_type	= Result;
+	using value_type	= typename Result::value_type;
+	using size_type		= Vectorsize;
+	using iterator		= aml::ConstIndexIterator<VectorExpression>;
+
+	template<class... Args> constexpr
+	explicit VectorExpression(std::in_place_t, Args&&... ops) noexcept
+		: operands(std::forward<Args>(ops)...) {}
+
+	/**
+		@brief Checks if the expression owns the moved vector of type @p Vec which buffer can be reused for the result
+	*/
+	template<class Vec>
+	static constexpr bool can_reuse_buffer() noexcept { 
+		return detail::owns_vector<VectorExpression, Vec>::value; 
+	}
+
+	/**
+		@brief Returns the first owned vector of type @p Vec
+
+		@see can_reuse_buffer()
+	*/
+	template<class Vec> constexpr
+	Vec& reused_buffer() noexcept {
+		static_assert(can_reuse_buffer<Vec>(), "The expression does not own the vector");
+		return this->reused_buffer_impl<Vec, 0>();
+	}
+
+	/**
+		@brief Always true, because the size of the expression is known only at runtime
+	*/
+	[[nodiscard]] static constexpr 
+	bool is_dynamic() noexcept { return true; }
+
+	[[nodiscard]] constexpr
+	size_type size() const noexcept {
+		return std::apply([](const auto&... ops) { return detail::operand_size(ops...); }, this->operands);
+	}
+
+	/**
+		@brief Computes the element of the expression
+	*/
+	[[nodiscard]] constexpr
+	value_type operator[](const size_type i) const noexcept {
+		return std::apply([i](const auto&... ops) {
+			return static_cast<value_type>(Operation{}(detail::expression_element(ops, i)...));
+		}, this->operands);
+	}
+
+	[[nodiscard]] constexpr
+	value_type first() const noexcept { return (*this)[0]; }
+
+	/**
+		@brief Creates the same expression where the contiguous vectors are replaced with raw pointers
+		@details The lowered expression does not know its size, so it is only indexed
+
+		@see detail::lower_operand()
+	*/
+	[[nodiscard]] constexpr
+	auto lower() const noexcept {
+		return std::apply([](const auto&... ops) {
+			return VectorExpression<Result, Operation, detail::lowered_operand<decltype(ops)>...>(std::in_place, detail::lower_operand(ops)...);
+		}, this->operands);
+	}
+
+	/**
+		@return Begin #iterator, which dereference computes the element
+	*/
+	[[nodiscard]] constexpr
+	iterator begin() const noexcept { return iterator(*this, 0); }
+
+	/**
+		@return End #iterator
+	*/
+	[[nodiscard]] constexpr
+	iterator end() const noexcept { return iterator(*this, static_cast<typename iterator::difference_type>(this->size())); }
+
+	/**
+		@brief Creates the new vector from the expression
+	*/
+	[[nodiscard]] AML_CONSTEXPR20
+	result_type evaluate() const& noexcept {
+		return result_type(*this);
+	}
+
+	/**
+		@brief Creates the new vector from the expression
+		@details If the expression owns the moved vector of the result type, 
+				 the result is written into its buffer without the allocation
+	*/
+	[[nodiscard]] AML_CONSTEXPR20
+	result_type evaluate() && noexcept 
+	{
+		if constexpr (can_reuse_buffer<result_type>()) {
+			result_type& buffer = this->reused_buffer<result_type>();
+			this->evaluate_to(buffer);
+			return std::move(buffer);
+		} else {
+			return result_type(static_cast<const VectorExpression&>(*this));
+		}
+	}
+
+	/**
+		@brief Writes the expression into the vector @p out
+		@details The vector @p out can be one of the expression operands
+
+		@warning The size of @p out must be the same as the size of the expression
+	*/
+	template<class Out> constexpr
+	void evaluate_to(Out& out) const noexcept
+	{
+		AML_DEBUG_VERIFY(out.size() == this->size(), "The vector must have the same size as the expression");
+		const size_type size = out.size();
+		const auto expr = this->lower();
+		auto&& dst = detail::lower_output(out);
+		detail::write_range(dst, [&](const size_type i) { return expr[i]; }, 0, size,
+			detail::is_streaming_output<aml::remove_cvref<decltype(dst)>>(size), expr);
+	}
+
+private:
+	template<class Vec, std::size_t I> constexpr
+	Vec& reused_buffer_impl() noexcept 
+	{
+		using operand_t = std::tuple_element_t<I, std::tuple<Operands...>>;
+		if constexpr (std::is_same_v<operand_t, Vec&&>) {
+			return std::get<I>(this->operands);
+		} else if constexpr (detail::owns_vector<operand_t, Vec>::value) {
+			return std::get<I>(this->operands).template reused_buffer<Vec>();
+		} else {
+			return this->reused_buffer_impl<Vec, I + 1>();
+		}
+	}
+
+	template<class, class, class...>
+	friend class VectorExpression;
+
+	template<class T>
+	friend void detail::prefetch_operand(const T&, Vectorsize) noexcept;
+
+	std::tuple<detail::expression_operand<Operands>...> operands;
+};
+
+namespace detail
+{
+	template<class Left, class Right> constexpr
+	void verify_vector_size([[maybe_unused]] const Left& left, [[maybe_unused]] const Right& right) noexcept
+	{
+		if constexpr (Left::is_dynamic() || Right::is_dynamic()) {
+			AML_DEBUG_VERIFY(left.size() == right.size(),
+				"Vector's sizes must be equal | left size: %zu, right size: %zu", left.size(), right.size());
+		} else {
+			static_assert(Left::static_size == Right::static_size, "Vector's sizes must be equal");
+		}
+	}
+
+	template<Vectorsize Start = 0, class Action, class Vec> constexpr
+	void iterate_vector(Action&& action, Vec&& vec) noexcept
+	{
+		if constexpr (vec.is_dynamic()) {
+			for (Vectorsize i = Start; i < vec.size(); ++i) {
+				action(i);
+			}
+		} else if constexpr ((vec.static_size - Start) > AML_VECTOR_UNROLL_MAX) {
+			// Static vectors are complete objects, so their elements can overlap only at the same index
+			AML_IVDEP AML_UNROLL(4)
+			for (Vectorsize i = Start; i < vec.static_size; ++i) {
+				action(i);
+			}
+		} else {
+			aml::static_for<Start, vec.static_size>(action);
+		}
+	}
+
+	template<Vectorsize First, Vectorsize Last, class Kernel> /** @cond */ AML_FORCEINLINE /** @endcond */ constexpr
+	void dispatch_size_between(Kernel& kernel, [[maybe_unused]] const Vectorsize size) noexcept
+	{
+		if constexpr (First == Last) {
+			kernel(std::integral_constant<Vectorsize, First>{});
+		} else {
+			constexpr Vectorsize middle = First + (Last - First) / 2;
+			if (size <= middle) {
+				detail::dispatch_size_between<First, middle>(kernel, size);
+			} else {
+				detail::dispatch_size_between<middle + 1, Last>(kernel, size);
+			}
+		}
+	}
+
+	/**
+		@brief Calls <tt>kernel(std::integral_constant<Vectorsize, N>{})</tt> if @p size is N from 2 to #AML_SMALL_SIZE_DISPATCH
+		@details The size is found by the binary search. The compilers turn the chain of the equality checks into the jump table, 
+				 whose indirect jump costs more than the loop on the processors with the indirect branch mitigations
+		@return @c false if the @p size is out of the range, then the caller uses the loop
+	*/
+	template<class Kernel> /** @cond */ AML_FORCEINLINE /** @endcond */ constexpr
+	bool dispatch_small_size([[maybe_unused]] Kernel& kernel, [[maybe_unused]] const Vectorsize size) noexcept
+	{
+		if constexpr (AML_SMALL_SIZE_DISPATCH < 2) {
+			return false;
+		} else {
+			if ((size - 2) > (AML_SMALL_SIZE_DISPATCH - 2)) {
+				return false;
+			}
+			detail::dispatch_size_between<2, AML_SMALL_SIZE_DISPATCH>(kernel, size);
+			return true;
+		}
+	}
+
+	/**
+		@brief Calls <tt>action(i)</tt> for [@p begin, @p end)
+		@tparam Independent The iterations do not depend on each other, so the loop needs no runtime aliasing checks
+	*/
+	template<bool Independent, class Action> /** @cond */ AML_FORCEINLINE /** @endcond */ constexpr
+	void for_range(Action& action, const Vectorsize begin, const Vectorsize end) noexcept
+	{
+		if constexpr (Independent) {
+			AML_IVDEP
+			for (Vectorsize i = begin; i < end; ++i) {
+				action(i);
+			}
+		} else {
+			for (Vectorsize i = begin; i < end; ++i) {
+				action(i);
+			}
+		}
+	}
+
+#if AML_DISPATCH_X86
+	template<bool Independent, class Action> AML_TARGET_AVX2
+	void for_range_avx2(Action& action, const Vectorsize begin, const Vectorsize end) noexcept {
+		detail::for_range<Independent>(action, begin, end);
+	}
+	template<bool Independent, class Action> AML_TARGET_AVX512
+	void for_range_avx512(Action& action, const Vectorsize begin, const Vectorsize end) noexcept {
+		detail::for_range<Independent>(action, begin, end);
+	}
+#endif
+
+	/**
+		@brief detail::for_range() compiled for aml::active_isa()
+	*/
+	template<bool Independent, class Action> constexpr
+	void dispatch_for_range(Action&& action, const Vectorsize begin, const Vectorsize end) noexcept
+	{
+#if AML_DISPATCH_X86
+		if (!AML_IS_CONSTANT_EVALUATED()) {
+			switch (aml::active_isa()) {
+			case aml::cpu_isa::avx512: return detail::for_range_avx512<Independent>(action, begin, end);
+			case aml::cpu_isa::avx2: return detail::for_range_avx2<Independent>(action, begin, end);
+			default: break;
+			}
+		}
+#endif
+		detail::for_range<Independent>(action, begin, end);
+	}
+
+	/**
+		@brief Prefetches the element @p i of the pointers of the lowered operand
+		@details The pointers of the lowered expression are prefetched recursively, other operands are ignored
+	*/
+	template<class T>
+	void prefetch_operand([[maybe_unused]] const T& operand, [[maybe_unused]] const Vectorsize i) noexcept
+	{
+		if constexpr (std::is_pointer_v<T>) {
+#if AML_GCC || AML_CLANG
+			__builtin_prefetch(operand + i, 0, 0);
+#elif AML_SSE2
+			_mm_prefetch(reinterpret_cast<const char*>(operand + i), _MM_HINT_NTA);
+#endif
+		} else if constexpr (is_vector_expression<T>::value) {
+			std::apply([i](const auto&... ops) { (detail::prefetch_operand(ops, i), ...); }, operand.operands);
+		}
+	}
+
+	/**
+		@brief Checks if the lowered output @p Dst of @p size elements is written with the non-temporal stores
+		@see #AML_STREAMING_THRESHOLD
+	*/
+	template<class Dst> constexpr
+	bool is_streaming_output([[maybe_unused]] const Vectorsize size) noexcept
+	{
+#if AML_SSE2
+		if constexpr (std::is_pointer_v<Dst> && std::is_arithmetic_v<std::remove_pointer_t<Dst>>) {
+			return (AML_STREAMING_THRESHOLD != 0) && ((size * sizeof(std::remove_pointer_t<Dst>)) >= AML_STREAMING_THRESHOLD)
+				&& !AML_IS_CONSTANT_EVALUATED();
+		}
+#endif
+		return false;
+	}
+
+#if AML_SSE2
+	/**
+		@brief Writes <tt>value(i)</tt> into @p dst for [@p begin, @p end) with the non-temporal stores
+		@details Every cache line of the output is computed into the array, which is written with the streaming stores.
+				 The head up to the cache line boundary and the tail use the ordinary stores
+	*/
+	template<class T, class Value, class... Sources>
+	void stream_range(T* const dst, Value& value, Vectorsize begin, const Vectorsize end, const Sources&... sources) noexcept
+	{
+		constexpr Vectorsize line_bytes = 64;
+		constexpr Vectorsize line = line_bytes / sizeof(T);
+		constexpr Vectorsize distance = AML_PREFETCH_DISTANCE / sizeof(T);
+
+		for (; (begin < end) && ((reinterpret_cast<std::uintptr_t>(dst + begin) % line_bytes) != 0); ++begin) {
+			dst[begin] = static_cast<T>(value(begin));
+		}
+		for (; (begin + line) <= end; begin += line) {
+			if constexpr (distance != 0) {
+				(detail::prefetch_operand(sources, begin + distance), ...);
+			}
+
+			alignas(line_bytes) T values[line];
+			for (Vectorsize j = 0; j < line; ++j) {
+				values[j] = static_cast<T>(value(begin + j));
+			}
+			for (Vectorsize j = 0; j < line_bytes; j += sizeof(__m128i)) {
+				_mm_stream_si128(reinterpret_cast<__m128i*>(reinterpret_cast<char*>(dst + begin) + j),
+					_mm_load_si128(reinterpret_cast<const __m128i*>(reinterpret_cast<const char*>(values) + j)));
+			}
+		}
+		for (; begin < end; ++begin) {
+			dst[begin] = static_cast<T>(value(begin));
+		}
+		// The non-temporal stores are weakly ordered
+		_mm_sfence();
+	}
+#endif
+
+	/**
+		@brief Writes <tt>value(i)</tt> into the lowered output @p dst for [@p begin, @p end)
+		@details Uses detail::stream_range() if @p streaming, otherwise detail::dispatch_for_range().
+				 The output must be the same as or must not overlap with the @p sources
+
+		@param sources The lowered operands which are prefetched by detail::stream_range()
+
+		@see detail::is_streaming_output()
+	*/
+	template<class Dst, class Value, class... Sources> constexpr
+	void write_range(Dst& dst, Value&& value, const Vectorsize begin, const Vectorsize end, [[maybe_unused]] const bool streaming,
+		[[maybe_unused]] const Sources&... sources) noexcept
+	{
+		using value_type = aml::remove_cvref<decltype(dst[0])>;
+
+#if AML_SSE2
+		if constexpr (std::is_pointer_v<Dst> && std::is_arithmetic_v<value_type>) {
+			if (streaming) {
+				return detail::stream_range(dst, value, begin, end, sources...);
+			}
+		}
+#endif
+		detail::dispatch_for_range<true>([&](const Vectorsize i) {
+			dst[i] = static_cast<value_type>(value(i));
+		}, begin, end);
+	}
+
+	/**
+		@brief Checks if the sums of @p T are split into the #AML_REDUCTION_LANES partial sums: the arithmetic types and the compensated accumulators
+	*/
+	template<class T>
+	inline constexpr bool is_lane_reduction = std::is_arithmetic_v<T> || aml::is_compensated_accumulator<T>;
+
+	/// The compensated accumulators add the elements directly, which is shorter than the addition of the converted ones
+	template<class T, class U> [[nodiscard]] /** @cond */ AML_FORCEINLINE /** @endcond */ constexpr
+	decltype(auto) lane_addend(const U& value) noexcept
+	{
+		if constexpr (aml::is_compensated_accumulator<T>) {
+			return value;
+		} else {
+			return static_cast<T>(value);
+		}
+	}
+
+	/**
+		@brief The accumulator of the reduction: @p OutType if it is the compensated accumulator, otherwise @p T
+	*/
+	template<class OutType, class T>
+	using reduction_type = std::conditional_t<aml::is_compensated_accumulator<OutType>, OutType, T>;
+
+	/**
+		@brief The term of aml::dot: the product of @p left and @p right in the compensated accumulator @p T, otherwise their product
+	*/
+	template<class T, class Left, class Right> [[nodiscard]] /** @cond */ AML_FORCEINLINE /** @endcond */ constexpr
+	auto dot_term(const Left& left, const Right& right) noexcept
+	{
+		if constexpr (aml::is_compensated_accumulator<T>) {
+			return T::product(left, right);
+		} else {
+			return left * right;
+		}
+	}
+
+	/**
+		@brief Adds <tt>map(operands[i]...)</tt> over [@p begin, @p end) to the #AML_REDUCTION_LANES partial sums @p acc
+		@details The range, which is not the last one, must be a multiple of the lanes count, so the ranges continue the same lanes
+	*/
+	template<class T, class Map, class... Operands> /** @cond */ AML_FORCEINLINE /** @endcond */ constexpr
+	void accumulate_lanes(T (&acc)[AML_REDUCTION_LANES], Map&& map, const Vectorsize begin, const Vectorsize end, Operands... operands) noexcept
+	{
+		constexpr Vectorsize lanes = AML_REDUCTION_LANES;
+		static_assert((lanes > 0) && ((lanes & (lanes - 1)) == 0), "AML_REDUCTION_LANES must be a power of two");
+
+		// The counted block loop is vectorized along the lanes. With the condition on the index GCC vectorizes it across the blocks instead
+		const Vectorsize blocks = (end - begin) / lanes;
+		Vectorsize i = begin;
+		for (Vectorsize block = 0; block < blocks; ++block, i += lanes) {
+			for (Vectorsize j = 0; j < lanes; ++j) {
+				acc[j] += detail::lane_addend<T>(map(operands[i + j]...));
+			}
+		}
+		// The remainder is bounded on the lane, so the compilers see that it does not run past the accumulators
+		const Vectorsize remainder = end - i;
+		for (Vectorsize j = 0; j < remainder; ++j) {
+			acc[j] += detail::lane_addend<T>(map(operands[i + j]...));
+		}
+	}
+
+	/**
+		@brief Adds the #AML_REDUCTION_LANES partial sums in pairs
+	*/
+	template<class T> /** @cond */ AML_FORCEINLINE /** @endcond */ constexpr
+	T fold_lanes(T (&acc)[AML_REDUCTION_LANES]) noexcept
+	{
+		for (Vectorsize width = AML_REDUCTION_LANES / 2; width > 0; width /= 2) {
+			for (Vectorsize j = 0; j < width; ++j) {
+				acc[j] += acc[j + width];
+			}
+		}
+		return acc[0];
+	}
+
+	template<class T, class = void>
+	struct has_bulk_conversion : std::false_type {};
+
+	template<class T>
+	struct has_bulk_conversion<T, std::void_t<decltype(convert_n(std::declval<const T*>(), Vectorsize{}, std::declval<aml::accumulation_type<T>*>()))>>
+		: std::bool_constant<!std::is_same_v<T, aml::accumulation_type<T>>> {};
+
+	/**
+		@brief Checks if the lowered operand is a pointer to the elements which are converted in blocks by the reductions
+		@details The element type must have the accumulation type (aml::accumulation_type) 
+				 and the bulk conversion to it, <tt>convert_n(const T* first, std::size_t count, aml::accumulation_type<T>* out)</tt> found by ADL
+	*/
+	template<class Operand>
+	inline constexpr bool is_converted_operand = 
+		std::is_pointer_v<Operand> && detail::has_bulk_conversion<std::remove_cv_t<std::remove_pointer_t<Operand>>>::value;
+
+	/**
+		@brief The lowered operand, which is not a pointer, indexed from @p offset
+	*/
+	template<class Operand>
+	struct offset_operand
+	{
+		Operand operand;
+		Vectorsize offset;
+
+		[[nodiscard]] /** @cond */ AML_FORCEINLINE /** @endcond */
+		decltype(auto) operator[](const Vectorsize i) const noexcept { return operand[offset + i]; }
+	};
+
+	/**
+		@brief Gives the block of the lowered operand, the elements with the bulk conversion are converted into the buffer
+		@details The pointers are advanced to the block, other lowered operands (vector expressions) are wrapped into detail::offset_operand
+	*/
+	template<class Operand, bool = detail::is_converted_operand<Operand>>
+	struct block_loader
+	{
+		Operand operand;
+
+		explicit block_loader(const Operand op) noexcept : operand(op) {}
+
+		auto load(const Vectorsize begin, Vectorsize) const noexcept
+		{
+			if constexpr (std::is_pointer_v<Operand>) {
+				return operand + begin;
+			} else {
+				return detail::offset_operand<Operand>{operand, begin};
+			}
+		}
+	};
+
+	template<class Operand>
+	struct block_loader<Operand, true>
+	{
+		using value_type = aml::accumulation_type<std::remove_cv_t<std::remove_pointer_t<Operand>>>;
+
+		Operand operand;
+		value_type buffer[AML_CONVERSION_BLOCK];
+
+		explicit block_loader(const Operand op) noexcept : operand(op) {}
+
+		const value_type* load(const Vectorsize begin, const Vectorsize count) noexcept
+		{
+			convert_n(operand + begin, count, buffer);
+			return buffer;
+		}
+	};
+
+	/**
+		@brief Sums in the lanes of detail::reduce_lanes() the operands which are converted in the blocks of #AML_CONVERSION_BLOCK elements
+		@details The conversion is exact and the blocks continue the same lanes, so the result is the same as the one of detail::reduce_lanes()
+	*/
+	template<class T, class Map, class... Operands> /** @cond */ AML_FORCEINLINE /** @endcond */
+	T reduce_converted(Map&& map, const Vectorsize begin, const Vectorsize end, Operands... operands) noexcept
+	{
+		static_assert((AML_CONVERSION_BLOCK % AML_REDUCTION_LANES) == 0, "AML_CONVERSION_BLOCK must be a multiple of AML_REDUCTION_LANES");
+
+		T acc[AML_REDUCTION_LANES] = {};
+		std::tuple<detail::block_loader<Operands>...> loaders{operands...};
+		for (Vectorsize block = begin; block < end; block += AML_CONVERSION_BLOCK) {
+			const Vectorsize count = (std::min)(Vectorsize{AML_CONVERSION_BLOCK}, end - block);
+			std::apply([&](auto&... loader) {
+				detail::accumulate_lanes(acc, map, 0, count, loader.load(block, count)...);
+			}, loaders);
+		}
+		return detail::fold_lanes(acc);
+	}
+
+	/**
+		@brief Sums <tt>map(operands[i]...)</tt> over [@p begin, @p end) in #AML_REDUCTION_LANES interleaved partial sums, which are added in pairs at the end
+		@details The lowered operands are the parameters (pointers are passed by value), so the compiler does not reload them in the loop and keeps the partial sums in the SIMD registers.
+				 The operands with the bulk conversion go through detail::reduce_converted()
+	*/
+	template<class T, class Map, class... Operands> /** @cond */ AML_FORCEINLINE /** @endcond */ constexpr
+	T reduce_lanes(Map&& map, const Vectorsize begin, const Vectorsize end, Operands... operands) noexcept
+	{
+		if constexpr ((detail::is_converted_operand<Operands> || ...)) {
+			return detail::reduce_converted<T, Map&, Operands...>(map, begin, end, operands...);
+		}
+		constexpr Vectorsize lanes = AML_REDUCTION_LANES;
+		T acc[lanes] = {};
+		detail::accumulate_lanes<T, Map&, Operands...>(acc, map, begin, end, operands...);
+		return detail::fold_lanes(acc);
+	}
+
+#if AML_DISPATCH_X86
+	template<class T, class Map, class... Operands> AML_TARGET_AVX2
+	T reduce_lanes_avx2(Map&& map, const Vectorsize begin, const Vectorsize end, Operands... operands) noexcept {
+		return detail::reduce_lanes<T, Map&, Operands...>(map, begin, end, operands...);
+	}
+	template<class T, class Map, class... Operands> AML_TARGET_AVX512
+	T reduce_lanes_avx512(Map&& map, const Vectorsize begin, const Vectorsize end, Operands... operands) noexcept {
+		return detail::reduce_lanes<T, Map&, Operands...>(map, begin, end, operands...);
+	}
+#endif
+
+	/**
+		@brief detail::reduce_lanes() compiled for aml::active_isa()
+		@details The lanes do not depend on the instruction set, so all paths give the same result.
+	*/
+	template<class T, class Map, class... Operands> constexpr
+	T dispatch_reduce_lanes(Map&& map, const Vectorsize begin, const Vectorsize end, Operands... operands) noexcept
+	{
+#if AML_DISPATCH_X86
+		if (!AML_IS_CONSTANT_EVALUATED()) {
+			switch (aml::active_isa()) {
+			case aml::cpu_isa::avx512: return detail::reduce_lanes_avx512<T, Map&, Operands...>(map, begin, end, operands...);
+			case aml::cpu_isa::avx2: return detail::reduce_lanes_avx2<T, Map&, Operands...>(map, begin, end, operands...);
+			default: break;
+			}
+		}
+#endif
+		return detail::reduce_lanes<T, Map&, Operands...>(map, begin, end, operands...);
+	}
+
+	/**
+		@brief Sums the halves of [@p begin, @p end) recursively. The blocks of #AML_PAIRWISE_BLOCK elements are summed by detail::reduce_lanes()
+	*/
+	template<class T, class Map, class... Operands> constexpr
+	T reduce_pairwise(Map&& map, const Vectorsize begin, const Vectorsize end, Operands... operands) noexcept
+	{
+		static_assert(AML_PAIRWISE_BLOCK >= (2 * AML_REDUCTION_LANES), "AML_PAIRWISE_BLOCK must be at least twice AML_REDUCTION_LANES");
+
+		if ((end - begin) <= AML_PAIRWISE_BLOCK) {
+			return detail::dispatch_reduce_lanes<T, Map&, Operands...>(map, begin, end, operands...);
+		}
+		// The halves start at the multiple of the lanes count, so their blocks stay aligned
+		const Vectorsize middle = begin + ((end - begin) / (2 * AML_REDUCTION_LANES)) * AML_REDUCTION_LANES;
+		return detail::reduce_pairwise<T, Map&, Operands...>(map, begin, middle, operands...)
+			 + detail::reduce_pairwise<T, Map&, Operands...>(map, middle, end, operands...);
+	}
+
+	/**
+		@brief Sums <tt>map(operands[i]...)</tt> over [@p begin, @p end) of the lowered operands
+		@details Uses detail::reduce_pairwise() if #AML_PAIRWISE_REDUCTION is defined, otherwise detail::dispatch_reduce_lanes()
+	*/
+	template<class T, class Map, class... Operands> constexpr
+	T reduce_range(Map&& map, const Vectorsize begin, const Vectorsize end, Operands... operands) noexcept
+	{
+#ifdef AML_PAIRWISE_REDUCTION
+		return detail::reduce_pairwise<T, Map&, Operands...>(map, begin, end, operands...);
+#else
+		return detail::dispatch_reduce_lanes<T, Map&, Operands...>(map, begin, end, operands...);
+#endif
+	}
+
+	/**
+		@brief Adds <tt>leaf(i)</tt> over [@p begin, @p end) in the pairwise tree whose shape depends only on the range
+	*/
+	template<class T, class Leaf> constexpr
+	T reduce_tree(Leaf&& leaf, const Vectorsize begin, const Vectorsize end) noexcept
+	{
+		if ((end - begin) == 1) {
+			return leaf(begin);
+		}
+		const Vectorsize middle = begin + ((end - begin) / 2);
+		return detail::reduce_tree<T>(leaf, begin, middle) + detail::reduce_tree<T>(leaf, middle, end);
+	}
+
+	/**
+		@brief Sums the fixed blocks of #AML_DETERMINISTIC_BLOCK elements with detail::reduce_range() and adds the block sums with detail::reduce_tree()
+	*/
+	template<class T, class Map, class... Operands> constexpr
+	T reduce_blocks(Map&& map, const Vectorsize size, Operands... operands) noexcept
+	{
+		static_assert((AML_DETERMINISTIC_BLOCK % AML_REDUCTION_LANES) == 0, "AML_DETERMINISTIC_BLOCK must be a multiple of AML_REDUCTION_LANES");
+
+		if (size <= AML_DETERMINISTIC_BLOCK) {
+			return detail::reduce_range<T, Map&, Operands...>(map, 0, size, operands...);
+		}
+		const Vectorsize blocks = (size + AML_DETERMINISTIC_BLOCK - 1) / AML_DETERMINISTIC_BLOCK;
+		return detail::reduce_tree<T>([&](const Vectorsize block) {
+			const Vectorsize begin = block * AML_DETERMINISTIC_BLOCK;
+			const Vectorsize end = (std::min)(size, begin + AML_DETERMINISTIC_BLOCK);
+			return detail::reduce_range<T, Map&, Operands...>(map, begin, end, operands...);
+		}, 0, blocks);
+	}
+
+	/**
+		@brief Sums <tt>map(operands[i]...)</tt> over the constant size @p N in the same order as detail::reduce_vector() does for that size
+	*/
+	template<class T, Vectorsize N, class Map, class... Operands> /** @cond */ AML_FORCEINLINE /** @endcond */ constexpr
+	T reduce_fixed(Map&& map, Operands... operands) noexcept
+	{
+		if constexpr (N < AML_REDUCTION_LANES) {
+			T out = static_cast<T>(map(operands[0]...));
+			aml::static_for<1, N>([&](const auto i) {
+				out += static_cast<T>(map(operands[i]...));
+			});
+			return out;
+		}
+#ifdef AML_PAIRWISE_REDUCTION
+		else if constexpr (N > AML_PAIRWISE_BLOCK) {
+			return detail::reduce_pairwise<T, Map&, Operands...>(map, 0, N, operands...);
+		}
+#endif
+		else {
+			return detail::reduce_lanes<T, Map&, Operands...>(map, 0, N, operands...);
+		}
+	}
+
+	template<class T, class Map, class Vec, class... Operands> constexpr
+	T reduce_serial(Map&& map, const Vec& vec, Operands... operands) noexcept
+	{
+		T out = static_cast<T>(map(operands[0]...));
+		detail::iterate_vector<1>([&](const auto i) {
+			out += static_cast<T>(map(operands[i]...));
+		}, vec);
+		return out;
 	}
-	template<class Operation, class Left, Vectorsize LeftSize> constexpr
-	auto do_vector_operation(const Vector<Left, LeftSize>& left) noexcept
+
+	/**
+		@brief Sums <tt>map(operands[i]...)</tt> over the indices of the vector @p vec
+		@details The arithmetic sums which are longer than #AML_REDUCTION_LANES use detail::reduce_range() or detail::reduce_blocks() if #AML_DETERMINISTIC_REDUCTION is defined, 
+				 other sums are serial.
+				 The small dynamic vectors are dispatched to detail::reduce_fixed().
+				 The operands are lowered with detail::lower_operand()
+	*/
+	template<class T, class Map, class Vec, class... Operands> constexpr
+	T reduce_vector(Map&& map, const Vec& vec, const Operands&... operands) noexcept
+	{
+		if constexpr (detail::is_lane_reduction<T> && Vec::is_dynamic()) {
+			T out{};
+			const auto unrolled = [&](const auto size) {
+				out = detail::reduce_fixed<T, decltype(size)::value, Map&, decltype(detail::lower_operand(operands))...>(map, detail::lower_operand(operands)...);
+			};
+			if (detail::dispatch_small_size(unrolled, vec.size())) {
+				return out;
+			}
+		}
+
+		constexpr bool is_long = []() {
+			if constexpr (Vec::is_dynamic()) { return true; }
+			else { return (Vec::static_size > AML_REDUCTION_LANES); }
+		}();
+
+		if constexpr (detail::is_lane_reduction<T> && is_long) {
+			if (vec.size() >= AML_REDUCTION_LANES) {
+#ifdef AML_DETERMINISTIC_REDUCTION
+				return detail::reduce_blocks<T, Map&, decltype(detail::lower_operand(operands))...>(map, vec.size(), detail::lower_operand(operands)...);
+#else
+				return detail::reduce_range<T, Map&, decltype(detail::lower_operand(operands))...>(map, 0, vec.size(), detail::lower_operand(operands)...);
+#endif
+			}
+		}
+		return detail::reduce_serial<T, Map&, Vec, decltype(detail::lower_operand(operands))...>(map, vec, detail::lower_operand(operands)...);
+	}
+
+	template<class Result, bool is_dynamic, class Action, class Left> constexpr
+	Result apply_vector_operation(Action&& action, Left&& left) noexcept
 	{
-		return apply_vector_operation<
-			aml::remove_cvref<decltype(left)>,
-			left.is_dynamic()
-		>([&](const auto i) {
-			return Operation{}(left[i]);
+		auto out = [&]() {
+			if constexpr (is_dynamic) { return Result(aml::size_initializer(left.size()), aml::uninitialized); }
+			else { return Result{}; }
+		}();
+
+		iterate_vector([&](const auto i) {
+			out[i] = action(i);
 		}, left);
+
+		return out;
 	}
 
-	template<class Operation, class Left, Vectorsize LeftSize, class Right, Vectorsize RightSize> constexpr
-	auto& do_vector_assign_operation(Vector<Left, LeftSize>& left, const Vector<Right, RightSize>& right) noexcept
+	template<class Operation, class Left, class Right, 
+		std::enable_if_t<is_vector_operand<Left> && is_vector_operand<Right>, int> = 0
+	> constexpr
+	auto do_vector_operation(Left&& left, Right&& right) noexcept
 	{
 		verify_vector_size(left, right);
-		iterate_vector([&](const auto i) {
-			Operation{}(left[i], right[i]);
-		}, aml::constexpr_ternary<left.is_dynamic()>(right, left));
+		using left_vec = vector_of_operand<Left>;
+		using right_vec = vector_of_operand<Right>;
+		using result_t = aml::rebind<
+			aml::common_type<left_vec, right_vec>,
+			aml::remove_cvref<decltype(Operation{}(left[0], right[0]))>
+		>;
+		if constexpr (left_vec::is_dynamic() || right_vec::is_dynamic()) {
+			return VectorExpression<result_t, Operation, expression_tag<Left>, expression_tag<Right>>(
+				std::in_place, std::forward<Left>(left), std::forward<Right>(right));
+		} else {
+			return apply_vector_operation<result_t, false>([&](const auto i) {
+				return Operation{}(left[i], right[i]);
+			}, left);
+		}
+	}
+	template<class Operation, bool swap_order, class Left, class Right> constexpr
+	auto do_vector_operation(Left&& left, Right&& right) noexcept
+	{
+		using left_vec = vector_of_operand<Left>;
+		using result_t = aml::rebind<left_vec, 
+			aml::common_type<
+				typename left_vec::value_type, 
+				aml::remove_cvref<Right>
+			>
+		>;
+		if constexpr (left_vec::is_dynamic()) {
+			if constexpr (swap_order) {
+				return VectorExpression<result_t, Operation, expression_tag<Right>, expression_tag<Left>>(
+					std::in_place, std::forward<Right>(right), std::forward<Left>(left));
+			} else {
+				return VectorExpression<result_t, Operation, expression_tag<Left>, expression_tag<Right>>(
+					std::in_place, std::forward<Left>(left), std::forward<Right>(right));
+			}
+		} else {
+			return apply_vector_operation<result_t, false>([&](const auto i) {
+				if constexpr (swap_order) {
+					return Operation{}(right, left[i]);
+				} else {
+					return Operation{}(left[i], right);
+				}
+			}, left);
+		}
+	}
+	template<class Operation, class Left> constexpr
+	auto do_vector_operation(Left&& left) noexcept
+	{
+		using left_vec = vector_of_operand<Left>;
+		if constexpr (left_vec::is_dynamic()) {
+			return VectorExpression<left_vec, Operation, expression_tag<Left>>(std::in_place, std::forward<Left>(left));
+		} else {
+			return apply_vector_operation<left_vec, false>([&](const auto i) {
+				return Operation{}(left[i]);
+			}, left);
+		}
+	}
+
+	template<class Operation, class Left, class Right, 
+		std::enable_if_t<is_vector_operand<Right>, int> = 0
+	> constexpr
+	auto& do_vector_assign_operation(Left& left, const Right& right) noexcept
+	{
+		verify_vector_size(left, right);
+		auto&& dst = detail::lower_output(left);
+		const auto& src = detail::lower_operand(right);
+		const auto action = [&](const auto i) {
+			Operation{}(dst[i], src[i]);
+		};
+		if constexpr (left.is_dynamic() && right.is_dynamic()) {
+			detail::dispatch_for_range<false>(action, 0, left.size());
+		} else {
+			iterate_vector(action, aml::constexpr_ternary<left.is_dynamic()>(right, left));
+		}
 		return left;
 	}
-	template<class Operation, class Left, Vectorsize LeftSize, class Right> constexpr
-	auto& do_vector_assign_operation(Vector<Left, LeftSize>& left, const Right& right) noexcept
+	template<class Operation, class Left, class Right, 
+		std::enable_if_t<!is_vector_operand<Right>, int> = 0
+	> constexpr
+	auto& do_vector_assign_operation(Left& left, const Right& right) noexcept
 	{
-		iterate_vector([&](const auto i) {
-			Operation{}(left[i], right);
-		}, left);
+		auto&& dst = detail::lower_output(left);
+		const auto action = [&](const auto i) {
+			Operation{}(dst[i], right);
+		};
+		if constexpr (left.is_dynamic()) {
+			detail::dispatch_for_range<true>(action, 0, left.size());
+		} else {
+			iterate_vector(action, left);
+		}
 		return left;
 	}
 }
@@ -1506,6 +2793,176 @@ auto operator/(const Vector<Left, LeftSize>&, const Vector<Right, RightSize>&) n
 template<class Left, Vectorsize LeftSize, class Right, Vectorsize RightSize> constexpr
 auto& operator/=(Vector<Left, LeftSize>&, const Vector<Right, RightSize>&) noexcept = delete;
 
+/**
+	@brief Sums up the vector expressions
+	@details At least one of the operands is a vector expression or a vector view. 
+			 The result is a lazy expression for the dynamic operands and a vector for the static ones
+
+	@see operator+(const Vector<Left, LeftSize>&, const Vector<Right, RightSize>&)
+*/
+template<class Left, class Right, 
+	std::enable_if_t<detail::is_expression_operation<Left, Right>, int> = 0
+> [[nodiscard]] constexpr
+auto operator+(Left&& left, Right&& right) noexcept {
+	return detail::do_vector_operation<aml::plus>(std::forward<Left>(left), std::forward<Right>(right));
+}
+
+/**
+	@brief Subtracts the vector expressions
+
+	@see operator-(const Vector<Left, LeftSize>&, const Vector<Right, RightSize>&)
+*/
+template<class Left, class Right, 
+	std::enable_if_t<detail::is_expression_operation<Left, Right>, int> = 0
+> [[nodiscard]] constexpr
+auto operator-(Left&& left, Right&& right) noexcept {
+	return detail::do_vector_operation<aml::minus>(std::forward<Left>(left), std::forward<Right>(right));
+}
+
+/**
+	@brief Multiplies the vector expression by scalar
+
+	@see operator*(const Vector<Left, LeftSize>&, const Right&)
+*/
+template<class Left, class Right, 
+	std::enable_if_t<detail::is_expression_scalar_operation<Left, Right>, int> = 0
+> [[nodiscard]] constexpr
+auto operator*(Left&& left, const Right& right) noexcept {
+	return detail::do_vector_operation<aml::multiplies, false>(std::forward<Left>(left), right);
+}
+template<class Left, class Right, 
+	std::enable_if_t<detail::is_expression_scalar_operation<Right, Left>, int> = 0
+> [[nodiscard]] constexpr
+auto operator*(const Left& left, Right&& right) noexcept {
+	return detail::do_vector_operation<aml::multiplies, true>(std::forward<Right>(right), left);
+}
+
+/**
+	@brief Divides the vector expression by scalar
+
+	@see operator/(const Vector<Left, LeftSize>&, const Right&)
+*/
+template<class Left, class Right, 
+	std::enable_if_t<detail::is_expression_scalar_operation<Left, Right>, int> = 0
+> [[nodiscard]] constexpr
+auto operator/(Left&& left, const Right& right) noexcept {
+	return detail::do_vector_operation<aml::divides, false>(std::forward<Left>(left), right);
+}
+template<class Left, class Right, 
+	std::enable_if_t<detail::is_expression_scalar_operation<Right, Left>, int> = 0
+> [[nodiscard]] constexpr
+auto operator/(const Left& left, Right&& right) noexcept {
+	return detail::do_vector_operation<aml::divides, true>(std::forward<Right>(right), left);
+}
+
+/**
+	@brief Negatives the vector expression
+*/
+template<class Left, 
+	std::enable_if_t<detail::is_lazy_operand<Left>, int> = 0
+> [[nodiscard]] constexpr
+auto operator-(Left&& left) noexcept {
+	return detail::do_vector_operation<aml::negate>(std::forward<Left>(left));
+}
+
+/**
+	@brief Sums up the expiring dynamic vector with the vector
+	@details The buffer of @p left is moved into the expression and reused for the result, 
+			 so <tt>std::move(a) + b + c</tt> does not allocate
+
+	@see operator+(const Vector<Left, LeftSize>&, const Vector<Right, RightSize>&)
+*/
+template<class Left, class Right, Vectorsize RightSize> [[nodiscard]] constexpr
+auto operator+(Vector<Left, dynamic_extent>&& left, const Vector<Right, RightSize>& right) noexcept {
+	return detail::do_vector_operation<aml::plus>(std::move(left), right);
+}
+template<class Left, Vectorsize LeftSize, class Right> [[nodiscard]] constexpr
+auto operator+(const Vector<Left, LeftSize>& left, Vector<Right, dynamic_extent>&& right) noexcept {
+	return detail::do_vector_operation<aml::plus>(left, std::move(right));
+}
+template<class Left, class Right> [[nodiscard]] constexpr
+auto operator+(Vector<Left, dynamic_extent>&& left, Vector<Right, dynamic_extent>&& right) noexcept {
+	return detail::do_vector_operation<aml::plus>(std::move(left), std::move(right));
+}
+
+/**
+	@brief Subtracts the vectors reusing the buffer of the expiring dynamic vector
+
+	@see operator+(Vector<Left, dynamic_extent>&&, const Vector<Right, RightSize>&)
+*/
+template<class Left, class Right, Vectorsize RightSize> [[nodiscard]] constexpr
+auto operator-(Vector<Left, dynamic_extent>&& left, const Vector<Right, RightSize>& right) noexcept {
+	return detail::do_vector_operation<aml::minus>(std::move(left), right);
+}
+template<class Left, Vectorsize LeftSize, class Right> [[nodiscard]] constexpr
+auto operator-(const Vector<Left, LeftSize>& left, Vector<Right, dynamic_extent>&& right) noexcept {
+	return detail::do_vector_operation<aml::minus>(left, std::move(right));
+}
+template<class Left, class Right> [[nodiscard]] constexpr
+auto operator-(Vector<Left, dynamic_extent>&& left, Vector<Right, dynamic_extent>&& right) noexcept {
+	return detail::do_vector_operation<aml::minus>(std::move(left), std::move(right));
+}
+
+/**
+	@brief Multiplies the expiring dynamic vector by scalar reusing its buffer
+*/
+template<class Left, class Right, 
+	std::enable_if_t<!detail::is_vector_operand<Right>, int> = 0
+> [[nodiscard]] constexpr
+auto operator*(Vector<Left, dynamic_extent>&& left, const Right& right) noexcept {
+	return detail::do_vector_operation<aml::multiplies, false>(std::move(left), right);
+}
+template<class Left, class Right, 
+	std::enable_if_t<!detail::is_vector_operand<Left>, int> = 0
+> [[nodiscard]] constexpr
+auto operator*(const Left& left, Vector<Right, dynamic_extent>&& right) noexcept {
+	return detail::do_vector_operation<aml::multiplies, true>(std::move(right), left);
+}
+
+/**
+	@brief Divides the expiring dynamic vector by scalar reusing its buffer
+*/
+template<class Left, class Right, 
+	std::enable_if_t<!detail::is_vector_operand<Right>, int> = 0
+> [[nodiscard]] constexpr
+auto operator/(Vector<Left, dynamic_extent>&& left, const Right& right) noexcept {
+	return detail::do_vector_operation<aml::divides, false>(std::move(left), right);
+}
+template<class Left, class Right, 
+	std::enable_if_t<!detail::is_vector_operand<Left>, int> = 0
+> [[nodiscard]] constexpr
+auto operator/(const Left& left, Vector<Right, dynamic_extent>&& right) noexcept {
+	return detail::do_vector_operation<aml::divides, true>(std::move(right), left);
+}
+
+/**
+	@brief Negatives the expiring dynamic vector reusing its buffer
+*/
+template<class Left> [[nodiscard]] constexpr
+auto operator-(Vector<Left, dynamic_extent>&& left) noexcept {
+	return detail::do_vector_operation<aml::negate>(std::move(left));
+}
+
+/**
+	@brief Evaluates the vector expression or reads the vector view and adds it to the @p left vector in a single pass
+*/
+template<class Left, Vectorsize LeftSize, class Right, 
+	std::enable_if_t<detail::is_lazy_operand<Right>, int> = 0
+> constexpr
+auto& operator+=(Vector<Left, LeftSize>& left, const Right& right) noexcept {
+	return detail::do_vector_assign_operation<aml::plus_assign>(left, right);
+}
+
+/**
+	@brief Evaluates the vector expression or reads the vector view and subtracts it from the @p left vector in a single pass
+*/
+template<class Left, Vectorsize LeftSize, class Right, 
+	std::enable_if_t<detail::is_lazy_operand<Right>, int> = 0
+> constexpr
+auto& operator-=(Vector<Left, LeftSize>& left, const Right& right) noexcept {
+	return detail::do_vector_assign_operation<aml::minus_assign>(left, right);
+}
+
 //#undef AML_OP_BODY1
 //#undef AML_OP_BODY2
 //#undef AML_OP_BODY3
@@ -1532,8 +2989,10 @@ bool operator==(const Vector<Left, LeftSize>& left, const Vector<Right, RightSiz
 		if constexpr (left.size() != right.size()) return false;
 	}
 
+	const auto& l = detail::lower_operand(left);
+	const auto& r = detail::lower_operand(right);
 	for (Vectorsize i = 0; i < left.size(); ++i) {
-		if (aml::not_equal(left[i], right[i])) return false;
+		if (aml::not_equal(l[i], r[i])) return false;
 	}
 	return true;
 }
@@ -1556,43 +3015,81 @@ bool operator!=(const Vector<Left, LeftSize>& left, const Vector<Right, RightSiz
 	return !(left == right);
 }
 
+/**
+	@brief Checks if the vector expressions are equal
+	@details The expressions are compared element by element without creating temporary vectors
+*/
+template<class Left, class Right, 
+	std::enable_if_t<detail::is_expression_operation<Left, Right>, int> = 0
+> [[nodiscard]] constexpr
+bool operator==(const Left& left, const Right& right) noexcept
+{
+	if (left.size() != right.size()) return false;
+
+	const auto& l = detail::lower_operand(left);
+	const auto& r = detail::lower_operand(right);
+	for (Vectorsize i = 0; i < left.size(); ++i) {
+		if (aml::not_equal(l[i], r[i])) return false;
+	}
+	return true;
+}
+
+/**
+	@brief Checks if the vector expressions are not equal
+*/
+template<class Left, class Right, 
+	std::enable_if_t<detail::is_expression_operation<Left, Right>, int> = 0
+> [[nodiscard]] constexpr
+bool operator!=(const Left& left, const Right& right) noexcept {
+	return !(left == right);
+}
+
 /**
 	@brief Vector distance, lenght, norm. @f$ || \vec{a} || @f$
 	@details @f$ = \sqrt{{\vec{a}_x}^{2}+{\vec{a}_y}^{2}+{\vec{a}_z}^{2}+...} @f$
 
-	@param vec A vector from which its length will be calculated
+	@param vec A vector or a vector expression from which its length will be calculated
 
 	@note
 		The return value type will be @c float, or <tt>value type</tt> if more precisely @c float
 
 */
-template<class OutType = selectable_unused, class T, Vectorsize Size> [[nodiscard]] constexpr
-auto dist(const aml::Vector<T, Size>& vec) noexcept 
+template<class OutType = selectable_unused, class Vec, 
+	std::enable_if_t<detail::is_vector_operand<Vec>, int> = 0
+> [[nodiscard]] constexpr
+auto dist(const Vec& vec) noexcept 
 {
+#ifdef AML_SIMD_VECTOR
+	if constexpr (detail::is_simd_operation<Vec, Vec>) {
+		if (!AML_IS_CONSTANT_EVALUATED()) {
+			return aml::selectable_convert<OutType>(detail::simd::dist(vec));
+		}
+	}
+#endif
 	using result_t = aml::common_type<float, aml::value_type_of<decltype(vec)>>;
-	result_t out = aml::sqr<result_t>(vec.first());
-
-	detail::iterate_vector<1>([&](const auto i) {
-		out += static_cast<result_t>(aml::sqr(vec[i]));
-	}, vec);
+	const result_t out = detail::reduce_vector<result_t>([](const auto& elem) {
+		return aml::sqr(elem);
+	}, vec, vec);
 
 	return aml::selectable_convert<OutType>(aml::sqrt(out));
 }
 
 /**
 	@brief Sum of all vector's elements. @f$ \sum_{i=0}^{n} \vec{a}_{i} @f$
-	@details @f$ = \vec{a}_x + \vec{a}_y + \vec{a}_ z + ... @f$
+	@details @f$ = \vec{a}_x + \vec{a}_y + \vec{a}_ z + ... @f$ @n
+			 The compensated accumulator (aml::double_double) as @p OutType accumulates the sum
 
-	@param vec A vector from which the sum of all its elements will be calculated
+	@param vec A vector or a vector expression from which the sum of all its elements will be calculated
 */
-template<class OutType = selectable_unused, class T, Vectorsize Size> [[nodiscard]] constexpr
-auto sum_of(const Vector<T, Size>& vec) noexcept 
+template<class OutType = selectable_unused, class Vec, 
+	std::enable_if_t<detail::is_vector_operand<Vec>, int> = 0
+> [[nodiscard]] constexpr
+auto sum_of(const Vec& vec) noexcept 
 {
-	auto out = vec.first();
-
-	detail::iterate_vector<1>([&](const auto i) {
-		out += vec[i];
-	}, vec);
+	using result_t = detail::reduction_type<OutType, aml::accumulation_type<aml::remove_cvref<decltype(vec.first())>>>;
+	const result_t out = detail::reduce_vector<result_t>([](const auto& elem) {
+		return elem;
+	}, vec, vec);
 
 	return aml::selectable_convert<OutType>(out);
 }
@@ -1601,25 +3098,61 @@ auto sum_of(const Vector<T, Size>& vec) noexcept
 	@brief Distance between vectors. @f$ || \vec{a} - \vec{b} || @f$
 	@details @f$ = \sqrt{(x_1-x_2)^2+(y_1-y_2)^2+...} @f$
 
-	@see aml::dist(const aml::Vector<T, Size>&)
+	@note For the dynamic vectors the difference is not stored in the temporary vector
+
+	@see aml::dist(const Vec&)
 */
 template<class OutType = selectable_unused, class Left, Vectorsize LeftSize, class Right, Vectorsize RightSize> [[nodiscard]] constexpr
 auto dist_between(const Vector<Left, LeftSize>& left, const Vector<Right, RightSize>& right) noexcept {
 	return aml::dist<OutType>(left - right);
 }
 
+namespace detail
+{
+	/// Defined in AML/Parallel.hpp, which also defines the execution policies
+	template<class T, class Policy, class Map, class Vec, class... Operands>
+	T parallel_reduce(const Policy& policy, Map&& map, const Vec& vec, const Operands&... operands) noexcept;
+}
+
 // vvvvv dot product impl vvvvv
 struct dot_fn {
-template<class OutType = selectable_unused, class Left, Vectorsize LeftSize, class Right, Vectorsize RightSize> [[nodiscard]] constexpr
-auto operator()(const Vector<Left, LeftSize>& left, const Vector<Right, RightSize>& right) const noexcept
+template<class OutType = selectable_unused, class Left, class Right, 
+	std::enable_if_t<detail::is_vector_operand<Left> && detail::is_vector_operand<Right>, int> = 0
+> [[nodiscard]] constexpr
+auto operator()(const Left& left, const Right& right) const noexcept
 {
-	auto out = (left.first() * right.first());
+#ifdef AML_SIMD_VECTOR
+	if constexpr (detail::is_simd_operation<Left, Right>) {
+		if (!AML_IS_CONSTANT_EVALUATED()) {
+			return aml::selectable_convert<OutType>(detail::simd::dot(left, right));
+		}
+	}
+#endif
+	detail::verify_vector_size(left, right);
+
+	using result_t = detail::reduction_type<OutType, aml::remove_cvref<decltype(left.first() * right.first())>>;
+	const result_t out = detail::reduce_vector<result_t>([](const auto& l, const auto& r) {
+		return detail::dot_term<result_t>(l, r);
+	}, left, left, right);
+
+	return aml::selectable_convert<OutType>(out);
+}
 
+/**
+	@brief Dot product which is split across the threads of the pool of AML/Parallel.hpp
+	@details Serial if the size is less than #AML_PARALLEL_THRESHOLD
+*/
+template<class OutType = selectable_unused, class Policy, class Left, class Right, 
+	std::enable_if_t<detail::is_execution_policy<Policy> && detail::is_vector_operand<Left> && detail::is_vector_operand<Right>, int> = 0
+> [[nodiscard]]
+auto operator()(const Policy& policy, const Left& left, const Right& right) const noexcept
+{
 	detail::verify_vector_size(left, right);
 
-	detail::iterate_vector<1>([&](const auto i) {
-		out += left[i] * right[i];
-	}, left);
+	using result_t = detail::reduction_type<OutType, aml::remove_cvref<decltype(left.first() * right.first())>>;
+	const result_t out = detail::parallel_reduce<result_t>(policy, [](const auto& l, const auto& r) {
+		return detail::dot_term<result_t>(l, r);
+	}, left, left, right);
 
 	return aml::selectable_convert<OutType>(out);
 }
@@ -1632,6 +3165,8 @@ auto operator()(const Vector<Left, LeftSize>& left, const Vector<Right, RightSiz
 
 				Can be used as the operator (vecres = vec1 @<dot@> vec2)
 
+				The compensated accumulator (aml::double_double) as @c OutType accumulates the exact products
+
 				[Wikipedia page](https://en.wikipedia.org/wiki/Dot_product)
 
 	@param left  First input vector
@@ -1665,25 +3200,38 @@ namespace detail {
 // vvvvv cross product impl vvvvv
 struct cross_fn
 {
-template<class Left, Vectorsize LeftSize, class Right, Vectorsize RightSize> [[nodiscard]] constexpr
-auto operator()(const Vector<Left, LeftSize>& left, const Vector<Right, RightSize>& right) const noexcept
+template<class Left, class Right, 
+	std::enable_if_t<detail::is_vector_operand<Left> && detail::is_vector_operand<Right>, int> = 0
+> [[nodiscard]] constexpr
+auto operator()(const Left& left, const Right& right) const noexcept
 {
-	if constexpr (left.is_dynamic() || right.is_dynamic()) {
+	using left_vec = detail::vector_of_operand<Left>;
+	using right_vec = detail::vector_of_operand<Right>;
+
+	if constexpr (left_vec::is_dynamic() || right_vec::is_dynamic()) {
 		AML_DEBUG_VERIFY((left.size() == right.size()) && (left.size() == 3), "The size of the vectors must be equal to 3 | left size: %zu, right size: %zu", left.size(), right.size());
 	} else {
-		static_assert((left.static_size == 3), "The size of the vectors must be equal to 3");
+		static_assert((left_vec::static_size == 3), "The size of the vectors must be equal to 3");
+	}
+
+#ifdef AML_SIMD_VECTOR
+	if constexpr (detail::is_simd_operation<Left, Right> && std::is_same_v<typename left_vec::value_type, float>) {
+		if (!AML_IS_CONSTANT_EVALUATED()) {
+			return detail::simd::cross(left, right);
+		}
 	}
+#endif
 
 	using result_t = aml::rebind<
-		aml::common_type<aml::remove_cvref<decltype(left)>, aml::remove_cvref<decltype(right)>>,
+		aml::common_type<left_vec, right_vec>,
 		aml::remove_cvref<decltype((left[0] * right[0]) - (left[0] * right[0]))>
 	>;
 
 	const auto& a = left; const auto& b = right;
 
 	auto out = [&]() {
-		if constexpr (left.is_dynamic()) { return result_t{left.size()}; }
-		else if constexpr (right.is_dynamic()) { return result_t{right.size()}; }
+		if constexpr (left_vec::is_dynamic()) { return result_t(aml::size_initializer(left.size()), aml::uninitialized); }
+		else if constexpr (right_vec::is_dynamic()) { return result_t(aml::size_initializer(right.size()), aml::uninitialized); }
 		else { return result_t{}; }
 	}();
 
@@ -1741,14 +3289,176 @@ namespace detail
 
 /**
 	@brief Normalizes the vector. @f$ \frac{\vec{a}}{ || \vec{a} || } @f$
+	@details The normalized dynamic vector is always evaluated, so the result does not depend on the lifetime of @p vec
+*/
+template<class Vec, 
+	std::enable_if_t<detail::is_vector_operand<Vec>, int> = 0
+> [[nodiscard]] constexpr
+auto normalize(const Vec& vec) noexcept 
+{
+#ifdef AML_SIMD_VECTOR
+	if constexpr (detail::is_simd_operation<Vec, Vec>) {
+		if (!AML_IS_CONSTANT_EVALUATED()) {
+			return detail::simd::normalize(vec);
+		}
+	}
+#endif
+	using disttype = decltype(aml::dist(vec));
+
+	const disttype inv_mag = static_cast<disttype>(1) / aml::dist(vec);
+	if constexpr (detail::vector_of_operand<Vec>::is_dynamic()) {
+		return (vec * inv_mag).evaluate();
+	} else {
+		return (vec * inv_mag);
+	}
+}
+
+// vvvvv output parameter kernels vvvvv
+
+namespace detail
+{
+	/**
+		@brief Writes <tt>action(i)</tt> into every element of the output vector @p out
+		@details The output can be a static vector, a dynamic vector or a vector view. Never allocates.
+				 The large dynamic outputs are written with the non-temporal stores, @p sources are the lowered operands which are prefetched
+
+		@see detail::write_range()
+	*/
+	template<class Out, class Action, class... Sources> constexpr
+	void write_vector(Out& out, Action&& action, [[maybe_unused]] const Sources&... sources) noexcept
+	{
+		using value_type = typename aml::remove_cvref<Out>::value_type;
+		auto&& dst = detail::lower_output(out);
+		if constexpr (aml::remove_cvref<Out>::is_dynamic()) {
+			// The output is the same as or does not overlap with the operands, so the loop needs no runtime aliasing checks
+			const Vectorsize size = out.size();
+			detail::write_range(dst, action, 0, size, detail::is_streaming_output<aml::remove_cvref<decltype(dst)>>(size), sources...);
+		} else {
+			detail::iterate_vector([&](const auto i) {
+				dst[i] = static_cast<value_type>(action(i));
+			}, out);
+		}
+	}
+}
+
+/**
+	@brief Writes the sum of the vectors into @p out. @f$ \vec{out} = \vec{a} + \vec{b} @f$
+	@details Allocation-free alternative to <tt>out = left + right</tt>.
+			 The sizes are verified in the debug build
+
+	@param out Static vector, dynamic vector or vector view with the same size as the operands. 
+			   Can be the same vector as one of the operands, but must not partially overlap with them
+*/
+template<class Out, class Left, class Right, 
+	std::enable_if_t<detail::is_vector_operand<Out> && detail::is_vector_operand<Left> && detail::is_vector_operand<Right>, int> = 0
+> constexpr
+void add(Out&& out, const Left& left, const Right& right) noexcept
+{
+	detail::verify_vector_size(out, left);
+	detail::verify_vector_size(left, right);
+	const auto& l = detail::lower_operand(left);
+	const auto& r = detail::lower_operand(right);
+	detail::write_vector(out, [&](const auto i) { return l[i] + r[i]; }, l, r);
+}
+
+/**
+	@brief Writes the difference of the vectors into @p out. @f$ \vec{out} = \vec{a} - \vec{b} @f$
+
+	@see aml::add()
+*/
+template<class Out, class Left, class Right, 
+	std::enable_if_t<detail::is_vector_operand<Out> && detail::is_vector_operand<Left> && detail::is_vector_operand<Right>, int> = 0
+> constexpr
+void sub(Out&& out, const Left& left, const Right& right) noexcept
+{
+	detail::verify_vector_size(out, left);
+	detail::verify_vector_size(left, right);
+	const auto& l = detail::lower_operand(left);
+	const auto& r = detail::lower_operand(right);
+	detail::write_vector(out, [&](const auto i) { return l[i] - r[i]; }, l, r);
+}
+
+/**
+	@brief Writes the vector multiplied by the scalar into @p out. @f$ \vec{out} = s \vec{a} @f$
+
+	@see aml::add()
+*/
+template<class Out, class Vec, class Scalar, 
+	std::enable_if_t<detail::is_vector_operand<Out> && detail::is_vector_operand<Vec> && !detail::is_vector_operand<Scalar>, int> = 0
+> constexpr
+void scale(Out&& out, const Vec& vec, const Scalar& scalar) noexcept
+{
+	detail::verify_vector_size(out, vec);
+	const auto& v = detail::lower_operand(vec);
+	detail::write_vector(out, [&](const auto i) { return v[i] * scalar; }, v);
+}
+
+/**
+	@brief Writes the normalized vector into @p out
+
+	@see aml::normalize(), aml::add()
 */
-template<class T, Vectorsize Size> [[nodiscard]] constexpr
-auto normalize(const Vector<T, Size>& vec) noexcept 
+template<class Out, class Vec, 
+	std::enable_if_t<detail::is_vector_operand<Out> && detail::is_vector_operand<Vec>, int> = 0
+> constexpr
+void normalize_into(Out&& out, const Vec& vec) noexcept
 {
+	detail::verify_vector_size(out, vec);
+#ifdef AML_SIMD_VECTOR
+	if constexpr (detail::is_simd_operation<Out, Vec>) {
+		if (!AML_IS_CONSTANT_EVALUATED()) {
+			detail::simd::normalize<aml::remove_cvref<Vec>::static_size>(detail::simd::data(out), detail::simd::data(vec));
+			return;
+		}
+	}
+#endif
 	using disttype = decltype(aml::dist(vec));
 
 	const disttype inv_mag = static_cast<disttype>(1) / aml::dist(vec);
-	return (vec * inv_mag);
+	const auto& v = detail::lower_operand(vec);
+	detail::write_vector(out, [&](const auto i) { return v[i] * inv_mag; }, v);
+}
+
+/**
+	@brief Writes the cross product of the vectors into @p out
+
+	@see aml::cross, aml::add()
+*/
+template<class Out, class Left, class Right, 
+	std::enable_if_t<detail::is_vector_operand<Out> && detail::is_vector_operand<Left> && detail::is_vector_operand<Right>, int> = 0
+> constexpr
+void cross_into(Out&& out, const Left& left, const Right& right) noexcept
+{
+	detail::verify_vector_size(out, left);
+	detail::verify_vector_size(left, right);
+	if constexpr (detail::vector_of_operand<Left>::is_dynamic()) {
+		AML_DEBUG_VERIFY(left.size() == 3, "The size of the vectors must be equal to 3 | size: %zu", left.size());
+	} else {
+		static_assert((detail::vector_of_operand<Left>::static_size == 3), "The size of the vectors must be equal to 3");
+	}
+
+#ifdef AML_SIMD_VECTOR
+	if constexpr (detail::is_simd_operation<Out, Left> && detail::is_simd_operation<Left, Right> 
+		&& std::is_same_v<typename aml::remove_cvref<Out>::value_type, float>) {
+		if (!AML_IS_CONSTANT_EVALUATED()) {
+			detail::simd::store<3>(detail::simd::data(out), detail::simd::cross(detail::simd::load<3>(detail::simd::data(left)), detail::simd::load<3>(detail::simd::data(right))));
+			return;
+		}
+	}
+#endif
+
+	using namespace aml::VI;
+	using value_type = typename aml::remove_cvref<Out>::value_type;
+
+	// The output can be one of the operands, so the elements are read before the writing
+	const auto& a = left; const auto& b = right;
+	const auto x = (a[Y] * b[Z]) - (a[Z] * b[Y]);
+	const auto y = (a[Z] * b[X]) - (a[X] * b[Z]);
+	const auto z = (a[X] * b[Y]) - (a[Y] * b[X]);
+
+	out[X] = static_cast<value_type>(x);
+	out[Y] = static_cast<value_type>(y);
+	out[Z] = static_cast<value_type>(z);
 }
 
 /**
@@ -0,0 +1,429 @@
+/** @file */
+#pragma once
+
+#include <AML/Vector.hpp>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <type_traits>
+
+#ifdef AML_LIBRARY
+	#define AML_LIBRARY_VECTOR_ARRAY
+#else
+	#error AML library is required
+#endif
+
+namespace aml
+{
+
+template<class T, Vectorsize Size>
+class VectorArray;
+
+template<class T, Vectorsize Size>
+void transpose_to_soa(const Vector<T, Size>* aos, std::size_t count, VectorArray<T, Size>& soa);
+
+template<class T, Vectorsize Size>
+void transpose_to_aos(const VectorArray<T, Size>& soa, Vector<T, Size>* aos) noexcept;
+
+/**
+	@brief Structure-of-arrays container of static vectors
+	@details Every component of the vectors is stored in the separate contiguous column.
+			 The bulk operations (aml::dot_each, aml::cross_each, aml::normalize_each, aml::dist_each, operators)
+			 iterate over the columns, so the loops are vectorized across the vectors instead of across the components
+
+	@tparam T The type of the components
+	@tparam Size The size of every vector
+
+	@see aml::Vector<T, Size>
+*/
+template<class T, Vectorsize Size>
+class VectorArray
+{
+	static_assert(Size != aml::dynamic_extent, "VectorArray stores only static vectors");
+	static_assert(std::is_arithmetic_v<T>, "VectorArray's T must be an arithmetic type");
+public:
+
+	using value_type	= T;
+	using size_type		= std::size_t;
+	using vector_type	= aml::Vector<T, Size>;		///< The type of a single vector of the array
+	using column_type	= std::vector<T>;			///< The type of a single component column
+
+	/// Static compile-time variable defining the size of every vector
+	static constexpr size_type static_size = Size;
+
+	VectorArray() = default;
+
+	/**
+		@brief Creates the array of @p initsz vectors
+
+		@warning The vectors are zero-initialized
+	*/
+	explicit VectorArray(const aml::size_initializer initsz) {
+		this->resize(initsz.size);
+	}
+
+	/**
+		@brief Transposes the array of structures into the structure of arrays
+
+		@see aml::transpose_to_soa
+	*/
+	explicit VectorArray(const std::vector<vector_type>& vecs) {
+		aml::transpose_to_soa(vecs.data(), vecs.size(), *this);
+	}
+
+	/**
+		@return Returns the number of the vectors
+	*/
+	[[nodiscard]]
+	size_type size() const noexcept { return this->columns[0].size(); }
+
+	[[nodiscard]]
+	bool empty() const noexcept { return this->columns[0].empty(); }
+
+	void resize(const size_type new_size) {
+		for (auto& column : this->columns) column.resize(new_size);
+	}
+
+	void reserve(const size_type new_capacity) {
+		for (auto& column : this->columns) column.reserve(new_capacity);
+	}
+
+	void clear() noexcept {
+		for (auto& column : this->columns) column.clear();
+	}
+
+	void push_back(const vector_type& vec)
+	{
+		aml::static_for<Size>([&](const auto c) {
+			this->columns[c].push_back(vec[c]);
+		});
+	}
+
+	/**
+		@brief Gathers the vector from the columns
+	*/
+	[[nodiscard]]
+	vector_type operator[](const size_type index) const noexcept
+	{
+		AML_DEBUG_VERIFY(index < this->size(), "VectorArray index out of range | index: %zu", index);
+		vector_type out;
+		aml::static_for<Size>([&](const auto c) {
+			out[c] = this->columns[c][index];
+		});
+		return out;
+	}
+
+	/**
+		@brief Scatters the vector @p vec into the columns
+	*/
+	void set(const size_type index, const vector_type& vec) noexcept
+	{
+		AML_DEBUG_VERIFY(index < this->size(), "VectorArray index out of range | index: %zu", index);
+		aml::static_for<Size>([&](const auto c) {
+			this->columns[c][index] = vec[c];
+		});
+	}
+
+	/**
+		@return Pointer to the first element of the component @p Component column
+	*/
+	[[nodiscard]]
+	value_type* column(const size_type component) noexcept
+	{
+		AML_DEBUG_VERIFY(component < Size, "VectorArray component out of range | component: %zu", component);
+		return this->columns[component].data();
+	}
+	[[nodiscard]]
+	const value_type* column(const size_type component) const noexcept {
+		return const_cast<VectorArray&>(*this).column(component);
+	}
+
+	/**
+		@brief Transposes the structure of arrays back into the array of structures
+
+		@see aml::transpose_to_aos
+	*/
+	[[nodiscard]]
+	std::vector<vector_type> to_vectors() const
+	{
+		std::vector<vector_type> out(this->size());
+		aml::transpose_to_aos(*this, out.data());
+		return out;
+	}
+
+private:
+	std::array<column_type, Size> columns;
+};
+
+namespace detail
+{
+	/// Number of vectors transposed at once, so the block of the array of structures stays in the L1 cache
+	inline constexpr std::size_t vector_array_transpose_block = 256;
+}
+
+/**
+	@brief Transposes @p count vectors from @p aos into the columns of @p soa
+	@details @p soa is resized to @p count.
+			 The vectors are transposed by blocks: every block of @p aos is read once from the memory
+			 and then written column by column with contiguous stores
+*/
+template<class T, Vectorsize Size>
+void transpose_to_soa(const Vector<T, Size>* const aos, const std::size_t count, VectorArray<T, Size>& soa)
+{
+	soa.resize(count);
+	T* columns[Size];
+	for (std::size_t c = 0; c < Size; ++c) columns[c] = soa.column(c);
+
+	for (std::size_t first = 0; first < count; first += detail::vector_array_transpose_block) {
+		const std::size_t last = std::min(count, first + detail::vector_array_transpose_block);
+		aml::static_for<Size>([&](const auto c) {
+			T* const column = columns[c];
+			for (std::size_t i = first; i < last; ++i) {
+				column[i] = aos[i][c];
+			}
+		});
+	}
+}
+
+/**
+	@brief Transposes the columns of @p soa into @p aos
+	@details @p aos must point to at least <tt>soa.size()</tt> vectors.
+			 The vectors are transposed by blocks: every block of @p aos is written while it stays in the cache
+*/
+template<class T, Vectorsize Size>
+void transpose_to_aos(const VectorArray<T, Size>& soa, Vector<T, Size>* const aos) noexcept
+{
+	const std::size_t count = soa.size();
+	const T* columns[Size];
+	for (std::size_t c = 0; c < Size; ++c) columns[c] = soa.column(c);
+
+	for (std::size_t first = 0; first < count; first += detail::vector_array_transpose_block) {
+		const std::size_t last = std::min(count, first + detail::vector_array_transpose_block);
+		aml::static_for<Size>([&](const auto c) {
+			const T* const column = columns[c];
+			for (std::size_t i = first; i < last; ++i) {
+				aos[i][c] = column[i];
+			}
+		});
+	}
+}
+
+namespace detail
+{
+	template<class T, Vectorsize Size, class Out, class Operation>
+	VectorArray<Out, Size> vector_array_operation(const VectorArray<T, Size>& left, Operation&& operation)
+	{
+		VectorArray<Out, Size> out(aml::size_initializer(left.size()));
+		const std::size_t count = left.size();
+		for (std::size_t c = 0; c < Size; ++c) {
+			Out* const o = out.column(c);
+			const T* const l = left.column(c);
+			for (std::size_t i = 0; i < count; ++i) {
+				o[i] = operation(l[i], c, i);
+			}
+		}
+		return out;
+	}
+
+	template<class T, Vectorsize Size, class Operation>
+	VectorArray<T, Size> vector_array_operation(const VectorArray<T, Size>& left, const VectorArray<T, Size>& right, Operation&& operation)
+	{
+		VectorArray<T, Size> out(aml::size_initializer(left.size()));
+		const std::size_t count = left.size();
+		for (std::size_t c = 0; c < Size; ++c) {
+			T* const o = out.column(c);
+			const T* const l = left.column(c);
+			const T* const r = right.column(c);
+			for (std::size_t i = 0; i < count; ++i) {
+				o[i] = operation(l[i], r[i]);
+			}
+		}
+		return out;
+	}
+
+	template<class Left, class Right, Vectorsize Size> constexpr
+	void verify_vector_array_size([[maybe_unused]] const VectorArray<Left, Size>& left, [[maybe_unused]] const VectorArray<Right, Size>& right) noexcept {
+		AML_DEBUG_VERIFY(left.size() == right.size(),
+			"VectorArray's sizes must be equal | left size: %zu, right size: %zu", left.size(), right.size());
+	}
+}
+
+/**
+	@brief Dot products of every pair of the vectors. @f$ r_i = \vec{a}_i \cdot \vec{b}_i @f$
+*/
+template<class Left, class Right, Vectorsize Size> [[nodiscard]]
+auto dot_each(const VectorArray<Left, Size>& left, const VectorArray<Right, Size>& right)
+{
+	detail::verify_vector_array_size(left, right);
+
+	using result_t = aml::remove_cvref<decltype(std::declval<Left>() * std::declval<Right>())>;
+	const std::size_t count = left.size();
+	std::vector<result_t> out(count);
+	result_t* const o = out.data();
+
+	for (std::size_t c = 0; c < Size; ++c) {
+		const Left* const l = left.column(c);
+		const Right* const r = right.column(c);
+		if (c == 0) {
+			for (std::size_t i = 0; i < count; ++i) o[i] = l[i] * r[i];
+		} else {
+			for (std::size_t i = 0; i < count; ++i) o[i] += l[i] * r[i];
+		}
+	}
+	return out;
+}
+
+/**
+	@brief Lengths of every vector. @f$ r_i = || \vec{a}_i || @f$
+*/
+template<class T, Vectorsize Size> [[nodiscard]]
+auto dist_each(const VectorArray<T, Size>& vecs)
+{
+	using result_t = aml::common_type<float, T>;
+	const std::size_t count = vecs.size();
+	std::vector<result_t> out(count);
+	result_t* const o = out.data();
+
+	for (std::size_t c = 0; c < Size; ++c) {
+		const T* const v = vecs.column(c);
+		for (std::size_t i = 0; i < count; ++i) {
+			o[i] += static_cast<result_t>(v[i]) * static_cast<result_t>(v[i]);
+		}
+	}
+	for (std::size_t i = 0; i < count; ++i) {
+		o[i] = aml::sqrt(o[i]);
+	}
+	return out;
+}
+
+/**
+	@brief Normalizes every vector. @f$ \frac{\vec{a}_i}{ || \vec{a}_i || } @f$
+*/
+template<class T, Vectorsize Size> [[nodiscard]]
+auto normalize_each(const VectorArray<T, Size>& vecs)
+{
+	using result_t = aml::common_type<float, T>;
+	std::vector<result_t> inv_mag = aml::dist_each(vecs);
+	for (auto& m : inv_mag) {
+		m = static_cast<result_t>(1) / m;
+	}
+
+	return detail::vector_array_operation<T, Size, result_t>(vecs, [&](const T v, std::size_t, const std::size_t i) {
+		return static_cast<result_t>(v) * inv_mag[i];
+	});
+}
+
+/**
+	@brief Cross products of every pair of the vectors. @f$ \vec{r}_i = \vec{a}_i \times \vec{b}_i @f$
+
+	@attention The size of the vectors must be equal to 3
+*/
+template<class Left, class Right, Vectorsize Size> [[nodiscard]]
+auto cross_each(const VectorArray<Left, Size>& left, const VectorArray<Right, Size>& right)
+{
+	static_assert(Size == 3, "The size of the vectors must be equal to 3");
+	detail::verify_vector_array_size(left, right);
+
+	using result_t = aml::remove_cvref<decltype(std::declval<Left>() * std::declval<Right>())>;
+	const std::size_t count = left.size();
+	auto out = VectorArray<result_t, 3>(aml::size_initializer(count));
+
+	const Left* const ax = left.column(0); const Left* const ay = left.column(1); const Left* const az = left.column(2);
+	const Right* const bx = right.column(0); const Right* const by = right.column(1); const Right* const bz = right.column(2);
+	result_t* const ox = out.column(0); result_t* const oy = out.column(1); result_t* const oz = out.column(2);
+
+	for (std::size_t i = 0; i < count; ++i) {
+		ox[i] = (ay[i] * bz[i]) - (az[i] * by[i]);
+		oy[i] = (az[i] * bx[i]) - (ax[i] * bz[i]);
+		oz[i] = (ax[i] * by[i]) - (ay[i] * bx[i]);
+	}
+	return out;
+}
+
+/**
+	@brief Sums up every pair of the vectors
+*/
+template<class T, Vectorsize Size> [[nodiscard]]
+VectorArray<T, Size> operator+(const VectorArray<T, Size>& left, const VectorArray<T, Size>& right)
+{
+	detail::verify_vector_array_size(left, right);
+	return detail::vector_array_operation(left, right, [](const T l, const T r) {
+		return static_cast<T>(l + r);
+	});
+}
+
+/**
+	@brief Subtracts every pair of the vectors
+*/
+template<class T, Vectorsize Size> [[nodiscard]]
+VectorArray<T, Size> operator-(const VectorArray<T, Size>& left, const VectorArray<T, Size>& right)
+{
+	detail::verify_vector_array_size(left, right);
+	return detail::vector_array_operation(left, right, [](const T l, const T r) {
+		return static_cast<T>(l - r);
+	});
+}
+
+/**
+	@brief Multiplies every vector by the scalar
+*/
+template<class T, Vectorsize Size> [[nodiscard]]
+VectorArray<T, Size> operator*(const VectorArray<T, Size>& left, const T right)
+{
+	return detail::vector_array_operation<T, Size, T>(left, [=](const T l, std::size_t, std::size_t) {
+		return static_cast<T>(l * right);
+	});
+}
+template<class T, Vectorsize Size> [[nodiscard]]
+VectorArray<T, Size> operator*(const T left, const VectorArray<T, Size>& right) {
+	return right * left;
+}
+
+/**
+	@brief Divides every vector by the scalar
+*/
+template<class T, Vectorsize Size> [[nodiscard]]
+VectorArray<T, Size> operator/(const VectorArray<T, Size>& left, const T right)
+{
+	return detail::vector_array_operation<T, Size, T>(left, [=](const T l, std::size_t, std::size_t) {
+		return static_cast<T>(l / right);
+	});
+}
+
+template<class T, Vectorsize Size>
+VectorArray<T, Size>& operator+=(VectorArray<T, Size>& left, const VectorArray<T, Size>& right) noexcept
+{
+	detail::verify_vector_array_size(left, right);
+	for (std::size_t c = 0; c < Size; ++c) {
+		T* const l = left.column(c);
+		const T* const r = right.column(c);
+		for (std::size_t i = 0; i < left.size(); ++i) l[i] += r[i];
+	}
+	return left;
+}
+
+template<class T, Vectorsize Size>
+VectorArray<T, Size>& operator-=(VectorArray<T, Size>& left, const VectorArray<T, Size>& right) noexcept
+{
+	detail::verify_vector_array_size(left, right);
+	for (std::size_t c = 0; c < Size; ++c) {
+		T* const l = left.column(c);
+		const T* const r = right.column(c);
+		for (std::size_t i = 0; i < left.size(); ++i) l[i] -= r[i];
+	}
+	return left;
+}
+
+template<class T, Vectorsize Size>
+VectorArray<T, Size>& operator*=(VectorArray<T, Size>& left, const T right) noexcept
+{
+	for (std::size_t c = 0; c < Size; ++c) {
+		T* const l = left.column(c);
+		for (std::size_t i = 0; i < left.size(); ++i) l[i] *= right;
+	}
+	return left;
+}
+
+}
@@ -0,0 +1,268 @@
+/** @file */
+#pragma once
+
+#include <AML/Vector.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#ifdef AML_LIBRARY
+	#define AML_LIBRARY_VECTOR_VIEW
+#else
+	#error AML library is required
+#endif
+
+namespace aml
+{
+
+namespace detail
+{
+	template<class T, Vectorsize Extent>
+	struct VectorViewStorage
+	{
+		constexpr VectorViewStorage(T* const ptr, [[maybe_unused]] const Vectorsize size) noexcept
+			: m_data(ptr) {
+			AML_DEBUG_VERIFY(size == Extent, "The size of the memory must be equal to the extent | size: %zu, extent: %zu", size, Extent);
+		}
+
+		static constexpr Vectorsize size() noexcept { return Extent; }
+
+		T* m_data;
+	};
+
+	template<class T>
+	struct VectorViewStorage<T, aml::dynamic_extent>
+	{
+		constexpr VectorViewStorage(T* const ptr, const Vectorsize size) noexcept
+			: m_data(ptr), m_size(size) {}
+
+		constexpr Vectorsize size() const noexcept { return m_size; }
+
+		T* m_data;
+		Vectorsize m_size;
+	};
+
+	/// Checks if the memory of @p Source can be viewed as the elements of type @p T
+	template<class Source, class T, class = void>
+	struct is_viewable : std::false_type {};
+	template<class Source, class T>
+	struct is_viewable<Source, T, std::void_t<decltype(std::declval<Source&>().data()), decltype(std::declval<Source&>().size())>>
+		: std::bool_constant<
+			std::is_pointer_v<decltype(std::declval<Source&>().data())> &&
+			std::is_convertible_v<std::remove_pointer_t<decltype(std::declval<Source&>().data())>(*)[], T(*)[]>
+		> {};
+}
+
+/**
+	@brief Non-owning view of the contiguous memory as a vector
+	@details Takes part in all vector operators, aml::dot, aml::dist, aml::normalize, aml::cross and comparisons
+			 without copying the memory into the vector.
+			 The result of the operation with the dynamic view is the lazy aml::VectorExpression which evaluates to aml::DVector,
+			 the result of the operation with the static view is aml::Vector<T, Extent>.
+			 @n
+			 Unlike @c std::span, the assignment writes the elements into the viewed memory,
+			 so the view can be the output of the operations (<tt>view = a + b</tt>)
+
+	@warning The view does not own the memory, so it must not outlive it
+
+	@tparam T The type of the elements, @c const for the read-only view
+	@tparam Extent The static size of the view or aml::dynamic_extent
+
+	@see aml::ConstVectorView
+*/
+template<class T, Vectorsize Extent>
+class VectorView /** @cond */: private detail::VectorViewStorage<T, Extent> /** @endcond */
+{
+	using Storage = detail::VectorViewStorage<T, Extent>;
+public:
+
+	using element_type		= T;
+	using value_type		= std::remove_cv_t<T>;
+	using size_type			= Vectorsize;
+
+	using pointer			= T*;
+	using reference			= T&;
+	using const_reference	= const T&;
+
+	using iterator			= T*;
+	using const_iterator	= const T*;
+
+	/// Static compile-time variable defining the size of the view
+	static constexpr size_type static_size = Extent;
+
+	/**
+		@brief Views @p size elements starting from @p ptr
+
+		@warning For the static view @p size must be equal to @p Extent
+	*/
+	constexpr
+	VectorView(const pointer ptr, const size_type size) noexcept
+		: Storage(ptr, size) {}
+
+	/**
+		@brief Views @p Extent elements starting from @p ptr
+	*/
+	template<class Ptr,
+		std::enable_if_t<(Extent != aml::dynamic_extent) && std::is_pointer_v<aml::remove_cvref<Ptr>> && std::is_convertible_v<Ptr, pointer>, int> = 0
+	> constexpr
+	explicit VectorView(Ptr&& ptr) noexcept
+		: Storage(ptr, Extent) {}
+
+	/**
+		@brief Views the static array
+	*/
+	template<std::size_t N,
+		std::enable_if_t<(Extent == aml::dynamic_extent) || (Extent == N), int> = 0
+	> constexpr
+	VectorView(element_type (&arr)[N]) noexcept
+		: Storage(arr, N) {}
+
+	/**
+		@brief Views the contiguous vector, container or the other view
+		@details The static vectors are contiguous if their size is greater than 5 or @c AML_CONTIGUOUS_VECTOR is defined
+
+		@see aml::is_contiguous_container
+	*/
+	template<class Source,
+		std::enable_if_t<detail::is_viewable<Source, T>::value && !std::is_same_v<aml::remove_cvref<Source>, VectorView>, int> = 0
+	> constexpr
+	VectorView(Source&& source) noexcept
+		: Storage(source.data(), static_cast<size_type>(source.size())) {}
+
+	constexpr
+	VectorView(const VectorView&) noexcept = default;
+
+	/**
+		@brief Writes the elements of @p other into the viewed memory
+		@details Does not rebind the view unlike @c std::span
+	*/
+	constexpr
+	const VectorView& operator=(const VectorView& other) const noexcept {
+		return this->assign(other);
+	}
+
+	/**
+		@brief Writes the vector, the vector expression or the other view into the viewed memory
+
+		@warning The sizes must be the same. The memory of @p right must be the same as or must not overlap with the viewed memory
+	*/
+	template<class Right,
+		std::enable_if_t<detail::is_vector_operand<Right>, int> = 0
+	> constexpr
+	const VectorView& operator=(const Right& right) const noexcept {
+		return this->assign(right);
+	}
+
+	template<class Right,
+		std::enable_if_t<detail::is_vector_operand<Right>, int> = 0
+	> constexpr
+	const VectorView& operator+=(const Right& right) const noexcept {
+		return detail::do_vector_assign_operation<aml::plus_assign>(*this, right);
+	}
+
+	template<class Right,
+		std::enable_if_t<detail::is_vector_operand<Right>, int> = 0
+	> constexpr
+	const VectorView& operator-=(const Right& right) const noexcept {
+		return detail::do_vector_assign_operation<aml::minus_assign>(*this, right);
+	}
+
+	template<class Right,
+		std::enable_if_t<!detail::is_vector_operand<Right>, int> = 0
+	> constexpr
+	const VectorView& operator*=(const Right& right) const noexcept {
+		return detail::do_vector_assign_operation<aml::multiplies_assign>(*this, right);
+	}
+
+	template<class Right,
+		std::enable_if_t<!detail::is_vector_operand<Right>, int> = 0
+	> constexpr
+	const VectorView& operator/=(const Right& right) const noexcept {
+		return detail::do_vector_assign_operation<aml::divides_assign>(*this, right);
+	}
+
+	[[nodiscard]] static constexpr
+	bool is_dynamic() noexcept { return (Extent == aml::dynamic_extent); }
+
+	[[nodiscard]] constexpr
+	size_type size() const noexcept { return Storage::size(); }
+
+	[[nodiscard]] constexpr
+	pointer data() const noexcept { return this->m_data; }
+
+	[[nodiscard]] constexpr
+	reference operator[](const size_type index) const noexcept {
+		AML_DEBUG_VERIFY(index < this->size(), "Vector view index out of range | index: %zu, size: %zu", index, this->size());
+		return this->m_data[index];
+	}
+
+	[[nodiscard]] constexpr
+	reference first() const noexcept { return (*this)[0]; }
+
+	[[nodiscard]] constexpr
+	iterator begin() const noexcept { return this->m_data; }
+
+	[[nodiscard]] constexpr
+	iterator end() const noexcept { return this->m_data + this->size(); }
+
+	[[nodiscard]] constexpr
+	const_iterator cbegin() const noexcept { return this->begin(); }
+
+	[[nodiscard]] constexpr
+	const_iterator cend() const noexcept { return this->end(); }
+
+	/**
+		@brief Views @p count elements starting from @p offset
+	*/
+	[[nodiscard]] constexpr
+	VectorView<T> subview(const size_type offset, const size_type count) const noexcept {
+		AML_DEBUG_VERIFY(offset + count <= this->size(), "The subview is out of range | offset: %zu, count: %zu, size: %zu", offset, count, this->size());
+		return VectorView<T>(this->m_data + offset, count);
+	}
+
+private:
+	template<class Right> constexpr
+	const VectorView& assign(const Right& right) const noexcept {
+		static_assert(!std::is_const_v<T>, "Cannot write into the constant vector view");
+		return detail::do_vector_assign_operation<aml::assignment>(*this, right);
+	}
+};
+
+/**
+	@brief Read-only view of the contiguous memory as a vector
+
+	@see aml::VectorView
+*/
+template<class T, Vectorsize Extent = aml::dynamic_extent>
+using ConstVectorView = aml::VectorView<const T, Extent>;
+
+template<class T>
+VectorView(T*, Vectorsize) -> VectorView<T>;
+
+template<class T, std::size_t N>
+VectorView(T (&)[N]) -> VectorView<T, N>;
+
+template<class T, Vectorsize Size>
+VectorView(aml::Vector<T, Size>&) -> VectorView<T, Size>;
+template<class T, Vectorsize Size>
+VectorView(const aml::Vector<T, Size>&) -> VectorView<const T, Size>;
+
+template<class Container>
+VectorView(aml::Vector<Container, aml::dynamic_extent>&)
+	-> VectorView<typename aml::Vector<Container, aml::dynamic_extent>::value_type>;
+template<class Container>
+VectorView(const aml::Vector<Container, aml::dynamic_extent>&)
+	-> VectorView<const typename aml::Vector<Container, aml::dynamic_extent>::value_type>;
+
+template<class T, class Allocator>
+VectorView(std::vector<T, Allocator>&) -> VectorView<T>;
+template<class T, class Allocator>
+VectorView(const std::vector<T, Allocator>&) -> VectorView<const T>;
+
+template<class T, std::size_t N>
+VectorView(std::array<T, N>&) -> VectorView<T, N>;
+template<class T, std::size_t N>
+VectorView(const std::array<T, N>&) -> VectorView<const T, N>;
+
+}
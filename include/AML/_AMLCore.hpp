@@ -80,6 +80,46 @@
 	#AML_FORCEINLINE inline
 #endif
 
+#define AML_PRAGMA(...) _Pragma(#__VA_ARGS__)
+
+// Tells the compiler that the loop iterations do not depend on each other
+#if AML_CLANG
+	#define AML_IVDEP AML_PRAGMA(clang loop vectorize(assume_safety))
+#elif AML_GCC
+	#define AML_IVDEP AML_PRAGMA(GCC ivdep)
+#elif AML_MSVC
+	#define AML_IVDEP __pragma(loop(ivdep))
+#else
+	#define AML_IVDEP
+#endif
+
+// Unrolls the loop @p n times
+#if AML_CLANG
+	#define AML_UNROLL(n) AML_PRAGMA(unroll n)
+#elif AML_GCC
+	#define AML_UNROLL(n) AML_PRAGMA(GCC unroll n)
+#else
+	#define AML_UNROLL(n)
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+	#define AML_SSE2 1
+#else
+	#define AML_SSE2 0
+#endif
+
+#if defined(__SSE4_1__) || defined(__AVX__)
+	#define AML_SSE41 1
+#else
+	#define AML_SSE41 0
+#endif
+
+#if defined(__AVX__)
+	#define AML_AVX 1
+#else
+	#define AML_AVX 0
+#endif
+
 #if defined(WIN32) || defined(_WIN32) || defined(__WIN32) && !defined(__CYGWIN__)
 	#define AML_WINDOWS 1
 #else
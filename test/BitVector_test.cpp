@@ -0,0 +1,131 @@
+#include "Testing.hpp"
+
+#include <AML/Vector.hpp>
+#include <AML/BitVector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+std::size_t hamming_of(const aml::DVector<float>& left, const aml::DVector<float>& right)
+{
+	std::size_t out = 0;
+	for (std::size_t i = 0; i < left.size(); ++i) {
+		out += ((left[i] > 0.f) != (right[i] > 0.f)) ? 1 : 0;
+	}
+	return out;
+}
+
+TEST(bit_vector_test, binarize)
+{
+	// The sizes are not multiples of the words and of the vector widths, so the remainders are tested too
+	for (const std::size_t size : {std::size_t{1}, std::size_t{64}, std::size_t{100}, std::size_t{777}}) {
+		const auto vec = make_wave_dvector(size, 0.5f);
+		const aml::BitVector bits(vec);
+		ASSERT_EQ(bits.size(), size);
+		ASSERT_EQ(bits.word_count(), (size + 63) / 64);
+
+		std::size_t positive = 0;
+		for (std::size_t i = 0; i < size; ++i) {
+			EXPECT_EQ(bits.test(i), vec[i] > 0.f);
+			positive += (vec[i] > 0.f) ? 1 : 0;
+		}
+		EXPECT_EQ(bits.count(), positive);
+		EXPECT_EQ((~bits).count(), size - positive);
+	}
+
+	// Zero and NaN are not positive
+	const float values[] = {0.f, -0.f, 1.f, -1.f, std::nanf("")};
+	std::uint64_t word = ~std::uint64_t{0};
+	aml::binarize_n(values, 5, &word);
+	EXPECT_EQ(word, 0b00100u);
+}
+
+TEST(bit_vector_test, bitwise)
+{
+	aml::BitVector a(aml::size_initializer(70));
+	aml::BitVector b(aml::size_initializer(70));
+	a.set(0);
+	a.set(65);
+	b.set(65);
+	b.set(69);
+
+	EXPECT_EQ((a & b).count(), 1u);
+	EXPECT_EQ((a | b).count(), 3u);
+	EXPECT_EQ((a ^ b).count(), 2u);
+	EXPECT_TRUE((a ^ b).test(69));
+	EXPECT_EQ((~a).count(), 68u);
+	EXPECT_EQ(~~a, a);
+	EXPECT_NE(a, b);
+
+	a.set(65, false);
+	EXPECT_FALSE(a.test(65));
+	EXPECT_EQ(aml::hamming_distance(a, b), 3u);
+}
+
+TEST(bit_vector_test, hamming_scan)
+{
+	// The codes of 777 bits take 13 words, which is not a multiple of the vector width
+	const std::size_t bits = 777;
+	const auto query_vec = make_wave_dvector(bits, 0.f);
+	const aml::BitVector query(query_vec);
+
+	aml::BitVectorArray codes(bits);
+	std::vector<aml::DVector<float>> vecs;
+	for (std::size_t c = 0; c < 50; ++c) {
+		vecs.push_back(make_wave_dvector(bits, static_cast<float>(c) * 0.1f));
+		if ((c % 2) == 0) {
+			codes.push_back(vecs.back());
+		} else {
+			codes.push_back(aml::BitVector(vecs.back()));
+		}
+	}
+	ASSERT_EQ(codes.size(), 50u);
+
+	const auto distances = aml::hamming_scan(query, codes);
+	ASSERT_EQ(distances.size(), 50u);
+	for (std::size_t c = 0; c < 50; ++c) {
+		EXPECT_EQ(distances[c], hamming_of(query_vec, vecs[c]));
+		EXPECT_EQ(aml::hamming_distance(query, aml::BitVector(vecs[c])), distances[c]);
+	}
+	EXPECT_EQ(distances[0], 0u);
+
+	// All the words differ
+	const aml::BitVector ones = ~aml::BitVector(aml::size_initializer(bits));
+	EXPECT_EQ(aml::hamming_distance(ones, aml::BitVector(aml::size_initializer(bits))), bits);
+	EXPECT_EQ(aml::detail::hamming_words_generic(ones.data(), query.data(), ones.word_count()), bits - query.count());
+}
+
+TEST(bit_vector_test, popcount)
+{
+	// Every kernel must agree with the generic one on the full and the remainder blocks
+	for (const std::size_t size : {std::size_t{0}, std::size_t{64}, std::size_t{700}, std::size_t{1000}}) {
+		const aml::BitVector bits(make_wave_dvector(size, 0.25f));
+		const std::uint64_t expected = aml::detail::popcount_words_generic(bits.data(), bits.word_count());
+		EXPECT_EQ(bits.count(), expected);
+		EXPECT_EQ(aml::detail::popcount_words(bits.data(), bits.word_count()), expected);
+#if AML_HAS_POPCNT_KERNELS
+		if (aml::detail::has_popcnt()) {
+			EXPECT_EQ(aml::detail::popcount_words_popcnt(bits.data(), bits.word_count()), expected);
+		}
+#endif
+#if AML_HAS_VPOPCNTDQ_KERNELS
+		if (aml::detail::has_vpopcntdq()) {
+			EXPECT_EQ(aml::detail::popcount_words_vpopcntdq(bits.data(), bits.word_count()), expected);
+		}
+#endif
+	}
+
+	// The count is not truncated to 32 bits
+	const std::uint64_t ones[] = {~std::uint64_t{0}, ~std::uint64_t{0}, ~std::uint64_t{0}};
+	EXPECT_EQ(aml::detail::popcount_words(ones, 3), 192u);
+	EXPECT_EQ(aml::detail::hamming_words(ones, ones, 3), 0u);
+	static_assert(std::is_same_v<decltype(aml::BitVector().count()), std::size_t>);
+	static_assert(std::is_same_v<decltype(aml::hamming_distance(aml::BitVector(), aml::BitVector())), std::size_t>);
+}
+
+}
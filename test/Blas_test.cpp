@@ -0,0 +1,80 @@
+#include "Testing.hpp"
+
+#include <AML/Blas.hpp>
+#include <AML/VectorView.hpp>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+TEST(blas_test, axpy)
+{
+	const aml::Vector<float, 3> x(1.f, 2.f, 3.f);
+	aml::Vector<float, 3> y(1.f, 1.f, 1.f);
+	aml::axpy(2, x, y);
+	EXPECT_EQ(y, (aml::Vector<float, 3>(3.f, 5.f, 7.f)));
+
+	aml::axpby(1.f, x, -1.f, y);
+	EXPECT_EQ(y, (aml::Vector<float, 3>(-2.f, -3.f, -4.f)));
+
+	aml::scal(-0.5f, y);
+	EXPECT_EQ(y, (aml::Vector<float, 3>(1.f, 1.5f, 2.f)));
+
+	const auto dx = make_dvector(37, -1.5);
+	auto dy = make_dvector(37, -1.5);
+	aml::axpy(3.f, dx, dy);
+	for (std::size_t i = 0; i < dy.size(); ++i) {
+		EXPECT_FLOAT_EQ(dy[i], 4.f * dx[i]);
+	}
+
+	double buf[4] = {1., 2., 3., 4.};
+	aml::scal(2., aml::VectorView<double>(buf, 4));
+	EXPECT_DOUBLE_EQ(buf[3], 8.);
+}
+
+TEST(blas_test, hadamard)
+{
+	const aml::DVector<int> x(1, 2, 3);
+	const aml::DVector<int> y(4, -5, 6);
+
+	aml::DVector<int> out(0, 0, 0);
+	aml::hadamard(out, x, y);
+	EXPECT_EQ(out, aml::DVector<int>(4, -10, 18));
+
+	aml::hadamard_add(out, x, y, out);
+	EXPECT_EQ(out, aml::DVector<int>(8, -20, 36));
+
+	aml::Vector<double, 2> s(0.5, 2.);
+	aml::hadamard_add(s, s, s, aml::Vector<double, 2>(1., 1.));
+	EXPECT_EQ(s, (aml::Vector<double, 2>(1.25, 5.)));
+}
+
+TEST(blas_test, reductions)
+{
+	const aml::Vector<float, 2> a(3.f, -4.f);
+	EXPECT_FLOAT_EQ(aml::nrm2(a), 5.f);
+	EXPECT_FLOAT_EQ(aml::asum(a), 7.f);
+	EXPECT_EQ(aml::iamax(a), 1);
+
+	const auto d = make_dvector(100, -1.5);
+	float sqr_sum = 0.f, abs_sum = 0.f;
+	for (const float elem : d) {
+		sqr_sum += elem * elem;
+		abs_sum += std::abs(elem);
+	}
+	EXPECT_FLOAT_EQ(aml::nrm2(d), std::sqrt(sqr_sum));
+	EXPECT_FLOAT_EQ(aml::asum(d), abs_sum);
+	EXPECT_EQ(aml::iamax(d), 0);
+
+	aml::DVector<int> i(aml::size_initializer(20), 1);
+	i[13] = -9;
+	i[17] = 9;
+	EXPECT_EQ(aml::iamax(i), 13);
+	EXPECT_EQ(aml::asum(i), 36);
+	i[5] = 9;
+	EXPECT_EQ(aml::iamax(i), 5);
+	i[18] = 10;
+	EXPECT_EQ(aml::iamax(i), 18);
+}
+
+}
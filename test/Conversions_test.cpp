@@ -0,0 +1,124 @@
+#include <AML/Vector.hpp>
+#include <AML/Conversions.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cfenv>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace {
+
+// The cases are repeated, so both the vectorized loop and the remainder convert them
+template<class From>
+std::vector<From> repeat_cases(const std::vector<From>& cases, const std::size_t size)
+{
+	std::vector<From> out(size);
+	for (std::size_t i = 0; i < size; ++i) {
+		out[i] = cases[i % cases.size()];
+	}
+	return out;
+}
+
+template<class From, class To>
+void expect_conversions(const std::vector<From>& cases, const aml::rounding mode, const std::vector<To>& expected)
+{
+	const auto values = repeat_cases(cases, cases.size() * 7);
+	std::vector<To> out(values.size());
+	aml::convert_n(values.data(), values.size(), out.data(), mode);
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		EXPECT_EQ(out[i], expected[i % expected.size()]) << "value " << values[i] << ", mode " << static_cast<int>(mode);
+	}
+}
+
+template<class From>
+void test_rounding()
+{
+	const From nan = std::numeric_limits<From>::quiet_NaN();
+	const std::vector<From> cases = {From(2.5), From(-2.5), From(3.5), From(-0.7), From(0.2), From(-0.), nan};
+
+	expect_conversions<From, std::int32_t>(cases, aml::rounding::truncate, {2, -2, 3, 0, 0, 0, 0});
+	expect_conversions<From, std::int32_t>(cases, aml::rounding::nearest_even, {2, -2, 4, -1, 0, 0, 0});
+	expect_conversions<From, std::int32_t>(cases, aml::rounding::floor, {2, -3, 3, -1, 0, 0, 0});
+	expect_conversions<From, std::int32_t>(cases, aml::rounding::ceil, {3, -2, 4, 0, 1, 0, 0});
+	expect_conversions<From, std::int16_t>(cases, aml::rounding::floor, {2, -3, 3, -1, 0, 0, 0});
+	expect_conversions<From, std::uint8_t>(cases, aml::rounding::ceil, {3, 0, 4, 0, 1, 0, 0});
+
+	const From inf = std::numeric_limits<From>::infinity();
+	const std::vector<From> large = {From(1e20), From(-1e20), inf, -inf, From(40000.), From(-40000.), From(255.5), From(2147483520.)};
+	expect_conversions<From, std::int32_t>(large, aml::rounding::nearest_even, {INT32_MAX, INT32_MIN, INT32_MAX, INT32_MIN, 40000, -40000, 256, 2147483520});
+	expect_conversions<From, std::int16_t>(large, aml::rounding::truncate, {INT16_MAX, INT16_MIN, INT16_MAX, INT16_MIN, INT16_MAX, INT16_MIN, 255, INT16_MAX});
+	expect_conversions<From, std::uint8_t>(large, aml::rounding::truncate, {255, 0, 255, 0, 255, 0, 255, 255});
+	expect_conversions<From, std::int64_t>(large, aml::rounding::floor, {INT64_MAX, INT64_MIN, INT64_MAX, INT64_MIN, 40000, -40000, 255, 2147483520});
+}
+
+TEST(conversions_test, rounding)
+{
+	test_rounding<float>();
+	test_rounding<double>();
+}
+
+TEST(conversions_test, scalar_kernel)
+{
+	// The vectorized kernels must give the same results as the scalar remainder for any number
+	std::vector<float> values(4099);
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		values[i] = std::ldexp(std::sin(static_cast<float>(i)), static_cast<int>(i % 40) - 8);
+	}
+	std::vector<std::int16_t> out(values.size());
+	aml::convert_n(values.data(), values.size(), out.data(), aml::rounding::floor);
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		EXPECT_EQ(out[i], (aml::detail::round_saturate<std::int16_t, aml::rounding::floor>(values[i])));
+	}
+}
+
+TEST(conversions_test, rounding_mode)
+{
+	// The nearest rounding of every kernel and of the remainder follows the rounding mode of the environment
+	std::vector<float> values(4099);
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		values[i] = std::ldexp(std::sin(static_cast<float>(i)), static_cast<int>(i % 20) - 4);
+	}
+	std::vector<std::int32_t> out(values.size());
+	for (const int mode : {FE_TONEAREST, FE_UPWARD, FE_DOWNWARD}) {
+		const int previous = std::fegetround();
+		std::fesetround(mode);
+		aml::convert_n(values.data(), values.size(), out.data(), aml::rounding::nearest_even);
+		for (std::size_t i = 0; i < values.size(); ++i) {
+			EXPECT_EQ(out[i], static_cast<std::int32_t>(std::nearbyint(values[i])));
+		}
+		std::fesetround(previous);
+	}
+
+	// The constant evaluation rounds to the nearest even
+	static_assert(aml::detail::round_integral<aml::rounding::nearest_even>(2.5) == 2.);
+	static_assert(aml::detail::round_integral<aml::rounding::floor>(-2.5f) == -3.f);
+	static_assert(aml::detail::round_integral<aml::rounding::ceil>(2.25) == 3.);
+	static_assert(aml::detail::round_integral<aml::rounding::truncate>(-2.75) == -2.);
+}
+
+TEST(conversions_test, vector_cast)
+{
+	aml::DVector<float> vec{aml::size_initializer(100)};
+	for (std::size_t i = 0; i < vec.size(); ++i) {
+		vec[i] = static_cast<float>(i) * -1.5f;
+	}
+	const aml::DVector<int> ints(vec);
+	const aml::DVector<double> doubles(vec);
+	const aml::DVector<float> back(ints);
+	ASSERT_EQ(ints.size(), vec.size());
+	for (std::size_t i = 0; i < vec.size(); ++i) {
+		EXPECT_EQ(ints[i], static_cast<int>(vec[i]));
+		EXPECT_EQ(doubles[i], static_cast<double>(vec[i]));
+		EXPECT_EQ(back[i], static_cast<float>(ints[i]));
+	}
+
+	// Wrapping of the integers is kept
+	const aml::DVector<int> wide(aml::size_initializer(3), aml::fill_initializer<int>(300));
+	const aml::DVector<std::uint8_t> narrow(wide);
+	EXPECT_EQ(narrow[2], static_cast<std::uint8_t>(300 % 256));
+}
+
+}
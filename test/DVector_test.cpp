@@ -1,8 +1,15 @@
 
 #include <AML/Vector.hpp>
+#include <AML/Allocators.hpp>
+#include <AML/Containers.hpp>
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <string>
+
 namespace {
 
 TEST(dynamic_vector_test, cast_from_dynamic_vector) {
@@ -192,6 +199,259 @@ TEST(dynamic_vector_test, functions) {
 	EXPECT_FLOAT_EQ(dist_between_a_b, dist_between_a_b_ans);
 }
 
+TEST(dynamic_vector_test, expressions)
+{
+	const aml::DVector<int> a(1, 2, 3);
+	const aml::DVector<int> b(10, 20, 30);
+	const aml::Vector<int, 3> c(-1, 0, 1);
+
+	const aml::DVector<int> r1 = a + b * 2 - c;
+	const aml::DVector<int> r1_ans(22, 42, 62);
+	EXPECT_EQ(r1, r1_ans);
+
+	const aml::DVector<int> r2 = -(a - b) / 3;
+	const aml::DVector<int> r2_ans(3, 6, 9);
+	EXPECT_EQ(r2, r2_ans);
+
+	aml::DVector<int> r3 = a;
+	r3 = r3 + r3 * 2;
+	const aml::DVector<int> r3_ans(3, 6, 9);
+	EXPECT_EQ(r3, r3_ans);
+
+	r3 -= a + c;
+	const aml::DVector<int> r3_minus_eq_ans(3, 4, 5);
+	EXPECT_EQ(r3, r3_minus_eq_ans);
+
+	EXPECT_EQ(a + b, b + a);
+	EXPECT_EQ(aml::dot(a + b, c), 22);
+	EXPECT_EQ(aml::sum_of(a * 3 - b), -42);
+	EXPECT_FLOAT_EQ(aml::dist(b - a), 33.6749165f);
+
+	const aml::DVector<int> cross_ans(-20, 40, -20);
+	EXPECT_EQ(aml::cross(a + c, b), cross_ans);
+}
+
+TEST(dynamic_vector_test, rvalue_operators)
+{
+	const aml::DVector<int> b(10, 20, 30);
+	const aml::DVector<int> c(1, 1, 1);
+
+	aml::DVector<int> a(1, 2, 3);
+	const int* const a_data = a.get_container().data();
+
+	const aml::DVector<int> r1 = std::move(a) + b - c;
+	const aml::DVector<int> r1_ans(10, 21, 32);
+	EXPECT_EQ(r1, r1_ans);
+	EXPECT_EQ(r1.get_container().data(), a_data);
+
+	aml::DVector<int> d(2, 4, 6);
+	const int* const d_data = d.get_container().data();
+
+	d = b - std::move(d) * 2;
+	const aml::DVector<int> d_ans(6, 12, 18);
+	EXPECT_EQ(d, d_ans);
+	EXPECT_EQ(d.get_container().data(), d_data);
+
+	const aml::DVector<int> e = -(aml::DVector<int>(1, 2, 3) / 1);
+	const aml::DVector<int> e_ans(-1, -2, -3);
+	EXPECT_EQ(e, e_ans);
+}
+
+TEST(dynamic_vector_test, uninitialized)
+{
+	using vector_t = aml::Vector<std::vector<int, aml::default_init_allocator<int>>, aml::dynamic_extent>;
+
+	const vector_t a(aml::size_initializer(4), aml::uninitialized);
+	ASSERT_EQ(a.size(), 4);
+
+	const vector_t b(1, 2, 3);
+	const vector_t c(10, 20, 30);
+
+	const auto b_plus_c = (b + c * 2).evaluate();
+	static_assert(std::is_same_v<aml::remove_cvref<decltype(b_plus_c)>, vector_t>);
+	const vector_t b_plus_c_ans(21, 42, 63);
+	EXPECT_EQ(b_plus_c, b_plus_c_ans);
+
+	const aml::DVector<long long> d(b + b_plus_c);
+	const aml::DVector<long long> d_ans(22, 44, 66);
+	EXPECT_EQ(d, d_ans);
+
+	const aml::DVector<float> e(aml::size_initializer(3), aml::fill_initializer<float>(2.5f));
+	const aml::DVector<float> e_ans(2.5f, 2.5f, 2.5f);
+	EXPECT_EQ(e, e_ans);
+}
+
+TEST(dynamic_vector_test, aligned_allocators)
+{
+	using aligned_vector = aml::Vector<std::vector<float, aml::aligned_allocator<float, 64>>, aml::dynamic_extent>;
+	using huge_vector = aml::Vector<std::vector<double, aml::huge_page_allocator<double>>, aml::dynamic_extent>;
+
+	const aligned_vector a(1.f, 2.f, 3.f);
+	const aligned_vector b(4.f, 5.f, 6.f);
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(a.data()) % 64, 0);
+
+	const auto a_plus_b = (a + b).evaluate();
+	static_assert(std::is_same_v<aml::remove_cvref<decltype(a_plus_b)>, aligned_vector>);
+	EXPECT_EQ(a_plus_b, (aml::DVector<float>(5.f, 7.f, 9.f)));
+
+	const auto a_times_two = (a * 2.).evaluate();
+	static_assert(std::is_same_v<aml::remove_cvref<decltype(a_times_two)>,
+		aml::Vector<std::vector<double, aml::aligned_allocator<double, 64>>, aml::dynamic_extent>>);
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(a_times_two.data()) % 64, 0);
+
+	// Large enough for the huge page mapping
+	const huge_vector c(aml::size_initializer(1 << 19), 1.5);
+	huge_vector d(aml::size_initializer(1 << 19), 0.5);
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(c.data()) % 64, 0);
+	d += c;
+	EXPECT_EQ(d[(1 << 19) - 1], 2.);
+	EXPECT_EQ(aml::sum_of(d), 2. * (1 << 19));
+
+	const huge_vector e(0.5, 1.5);
+	EXPECT_EQ(aml::dot(e, e), 2.5);
+}
+
+TEST(dynamic_vector_test, arena_allocator)
+{
+	using arena_vector = aml::Vector<std::vector<float, aml::arena_allocator<float>>, aml::dynamic_extent>;
+
+	const arena_vector outside(1.f, 2.f, 3.f);
+	EXPECT_EQ(outside.get_container().get_allocator().source(), nullptr);
+	{
+		aml::arena frame_arena(256);
+		EXPECT_EQ(aml::arena::current(), &frame_arena);
+
+		for (int frame = 0; frame < 3; ++frame) {
+			const arena_vector a(1.f, 2.f, 3.f);
+			const arena_vector b(aml::size_initializer(3), 2.f);
+			EXPECT_TRUE(frame_arena.owns(a.data()));
+
+			const auto a_plus_b = (a + b * 2.f).evaluate();
+			static_assert(std::is_same_v<aml::remove_cvref<decltype(a_plus_b)>, arena_vector>);
+			EXPECT_TRUE(frame_arena.owns(a_plus_b.data()));
+			EXPECT_EQ(a_plus_b, (aml::DVector<float>(5.f, 6.f, 7.f)));
+
+			const auto a_times_two = (a * 2.).evaluate();
+			EXPECT_TRUE(frame_arena.owns(a_times_two.data()));
+			EXPECT_EQ(a_times_two, (aml::DVector<double>(2., 4., 6.)));
+
+			// Larger than the block
+			const arena_vector large(aml::size_initializer(1000), 1.f);
+			EXPECT_TRUE(frame_arena.owns(large.data()));
+			EXPECT_EQ(aml::sum_of(large), 1000.f);
+			EXPECT_EQ(aml::dot(a, outside + aml::DVector<float>(0.f, 0.f, 0.f)), 14.f);
+		}
+		frame_arena.reset();
+	}
+	EXPECT_EQ(aml::arena::current(), nullptr);
+}
+
+TEST(dynamic_vector_test, small_vector)
+{
+	aml::small_vector<std::string, 2> strings{"a", "b"};
+	EXPECT_TRUE(strings.is_inline());
+	strings.push_back("c");
+	EXPECT_FALSE(strings.is_inline());
+	EXPECT_EQ(strings.size(), 3u);
+	EXPECT_EQ(strings.back(), "c");
+
+	auto moved = std::move(strings);
+	EXPECT_TRUE(strings.empty());
+	EXPECT_TRUE(strings.is_inline());
+	EXPECT_EQ(moved, (aml::small_vector<std::string, 4>{"a", "b", "c"}));
+
+	moved.resize(1);
+	auto copied = moved;
+	EXPECT_TRUE(copied.is_inline());
+	moved = std::move(copied);
+	EXPECT_EQ(moved.size(), 1u);
+	EXPECT_EQ(moved.front(), "a");
+}
+
+TEST(dynamic_vector_test, small_vector_aliasing)
+{
+	// The strings are longer than the small string buffer, so the moved-from strings are empty
+	const std::string first(32, 'a');
+	const std::string last(32, 'b');
+
+	// Growing from the inline storage and from the heap storage
+	aml::small_vector<std::string, 2> strings{first, last};
+	strings.push_back(strings.back());
+	EXPECT_FALSE(strings.is_inline());
+	strings.emplace_back(strings.front());
+	ASSERT_EQ(strings.size(), strings.capacity());
+	strings.push_back(strings.back());
+	EXPECT_EQ(strings, (aml::small_vector<std::string, 2>{first, last, last, first, first}));
+
+	strings.resize(strings.capacity() + 3, strings[1]);
+	EXPECT_EQ(strings.size(), 11u);
+	EXPECT_EQ(strings[4], first);
+	EXPECT_EQ(strings[5], last);
+	EXPECT_EQ(strings[10], last);
+}
+
+TEST(dynamic_vector_test, small_vector_container)
+{
+	using small_vector = aml::Vector<aml::small_vector<float, 4>, aml::dynamic_extent>;
+	static_assert(small_vector::is_contiguous());
+
+	const small_vector a(1.f, 2.f, 3.f);
+	const small_vector b(aml::size_initializer(3), 2.f);
+	EXPECT_TRUE(a.get_container().is_inline());
+
+	const auto a_plus_b = (a + b * 2.f).evaluate();
+	static_assert(std::is_same_v<aml::remove_cvref<decltype(a_plus_b)>, small_vector>);
+	EXPECT_TRUE(a_plus_b.get_container().is_inline());
+	EXPECT_EQ(a_plus_b, (aml::DVector<float>(5.f, 6.f, 7.f)));
+
+	const auto a_times_two = (a * 2.).evaluate();
+	EXPECT_TRUE(a_times_two.get_container().is_inline());
+	EXPECT_EQ(a_times_two, (aml::DVector<double>(2., 4., 6.)));
+	EXPECT_EQ(aml::dot(a, b), 12.f);
+
+	small_vector large(aml::size_initializer(100), 1.f);
+	EXPECT_FALSE(large.get_container().is_inline());
+	large += small_vector(aml::size_initializer(100), 2.f);
+	EXPECT_EQ(aml::sum_of(large), 300.f);
+	large = a_plus_b;
+	EXPECT_EQ(large, a_plus_b);
+}
+
+TEST(dynamic_vector_test, contiguous_containers)
+{
+	using deque_vector = aml::Vector<std::deque<int>, aml::dynamic_extent>;
+	static_assert(aml::DVector<int>::is_contiguous());
+	static_assert(!deque_vector::is_contiguous());
+	static_assert(!aml::is_contiguous_container<std::vector<bool>>);
+
+	const aml::DVector<int> a(1, -2, 3, 4);
+	const aml::DVector<int> b(5, 6, -7, 8);
+	const deque_vector c(1, -2, 3, 4);
+	const deque_vector d(5, 6, -7, 8);
+
+	const aml::DVector<int> a_plus_b = a + b * 2;
+	const deque_vector c_plus_d = c + d * 2;
+	const aml::DVector<int> c_plus_d_ans(11, 10, -11, 20);
+	EXPECT_EQ(a_plus_b, c_plus_d_ans);
+	EXPECT_EQ(c_plus_d, c_plus_d_ans);
+	EXPECT_EQ(a_plus_b, c_plus_d);
+
+	EXPECT_EQ(aml::dot(a, b), aml::dot(c, d));
+	EXPECT_EQ(aml::dot(a, d), 4);
+	EXPECT_EQ(aml::sum_of(a - b), aml::sum_of(c - d));
+	EXPECT_FLOAT_EQ(aml::dist(a), aml::dist(c));
+
+	auto a_mut = a;
+	auto c_mut = c;
+	a_mut += d;
+	c_mut += b;
+	EXPECT_EQ(a_mut, c_mut);
+	a_mut *= 3;
+	c_mut = c_mut * 3;
+	EXPECT_EQ(a_mut, c_mut);
+	EXPECT_NE(a_mut, a);
+}
+
 TEST(dynamic_vector_test, cast_from_static_vector) 
 {
 	const aml::Vector<int, 3> a(10, 20, 30);
@@ -264,4 +524,48 @@ TEST(DynamicAndStaticVectorTest, functions)
 	EXPECT_FLOAT_EQ(dist_between_a_b, dist_between_a_b_ans);
 }
 
+
+TEST(dynamic_vector_test, reductions)
+{
+	for (std::size_t size = 1; size < 300; size += 7) {
+		aml::DVector<float> a{aml::size_initializer(size)};
+		aml::DVector<float> b{aml::size_initializer(size)};
+		double dot_ans = 0., sum_ans = 0., sqr_ans = 0.;
+		for (std::size_t i = 0; i < size; ++i) {
+			a[i] = static_cast<float>(i % 13) * 0.25f - 1.f;
+			b[i] = static_cast<float>(i % 5) + 0.5f;
+			dot_ans += static_cast<double>(a[i]) * static_cast<double>(b[i]);
+			sum_ans += static_cast<double>(a[i]);
+			sqr_ans += static_cast<double>(a[i]) * static_cast<double>(a[i]);
+		}
+		EXPECT_NEAR(aml::dot(a, b), dot_ans, 1e-4 * static_cast<double>(size));
+		EXPECT_NEAR(aml::sum_of(a), sum_ans, 1e-4 * static_cast<double>(size));
+		EXPECT_NEAR(aml::dist(a), std::sqrt(sqr_ans), 1e-4 * static_cast<double>(size));
+	}
+
+	const aml::DVector<int> i(aml::size_initializer(100), 3);
+	EXPECT_EQ(aml::dot(i, i), 900);
+	EXPECT_EQ(aml::sum_of(i), 300);
+}
+
+TEST(dynamic_vector_test, small_size_reductions)
+{
+	// The sizes below the lanes count are summed serially whether they are dispatched to the unrolled sums or not.
+	// The compiler can contract the products and sums into FMA differently in the unrolled sums and in the reference loops
+	for (std::size_t size = 1; size < AML_REDUCTION_LANES; ++size) {
+		aml::DVector<float> a{aml::size_initializer(size)};
+		aml::DVector<float> b{aml::size_initializer(size)};
+		for (std::size_t i = 0; i < size; ++i) {
+			a[i] = static_cast<float>(i) * 0.1f + 0.3f;
+			b[i] = 1.f / static_cast<float>(i + 3);
+		}
+		const float dot_ans = std::inner_product(a.begin() + 1, a.end(), b.begin() + 1, a[0] * b[0]);
+		const float sqr_ans = std::inner_product(a.begin() + 1, a.end(), a.begin() + 1, a[0] * a[0]);
+		EXPECT_FLOAT_EQ(aml::dot(a, b), dot_ans);
+		EXPECT_FLOAT_EQ(aml::sum_of(a), std::accumulate(a.begin() + 1, a.end(), a[0]));
+		EXPECT_FLOAT_EQ(aml::dist(a), std::sqrt(sqr_ans));
+		EXPECT_FLOAT_EQ(aml::dot(a * 2.f, b), aml::dot(aml::DVector<float>(a * 2.f), b));
+	}
+}
+
 }
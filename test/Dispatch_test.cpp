@@ -0,0 +1,57 @@
+#include "Testing.hpp"
+
+#include <AML/Vector.hpp>
+#include <AML/Dispatch.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+namespace {
+
+TEST(dispatch_test, isa)
+{
+	EXPECT_STREQ(aml::isa_name(aml::cpu_isa::sse2), "sse2");
+	EXPECT_STREQ(aml::isa_name(aml::cpu_isa::avx2), "avx2");
+	EXPECT_STREQ(aml::isa_name(aml::cpu_isa::avx512), "avx512");
+
+	EXPECT_LE(aml::active_isa(), aml::detected_isa());
+	EXPECT_EQ(aml::active_isa(), aml::active_isa());
+#ifndef AML_CPU_DISPATCH
+	EXPECT_EQ(aml::detected_isa(), aml::cpu_isa::sse2);
+#endif
+}
+
+TEST(dispatch_test, kernels)
+{
+	// The sizes are not multiples of the vector widths, so the remainders are tested too
+	for (const std::size_t size : {std::size_t{1}, std::size_t{7}, std::size_t{33}, std::size_t{1001}}) {
+		const auto a = make_dvector(size, 1.f);
+		const auto b = make_dvector(size, -2.f);
+
+		aml::DVector<float> out{aml::size_initializer(size)};
+		aml::add(out, a, b);
+		for (std::size_t i = 0; i < size; ++i) {
+			EXPECT_EQ(out[i], a[i] + b[i]);
+		}
+
+		out -= b;
+		EXPECT_EQ(out, a);
+		out *= 2.f;
+		EXPECT_EQ(out, a * 2.f);
+
+		float expected = 0.f;
+		for (std::size_t i = 0; i < size; ++i) {
+			expected += a[i] * b[i];
+		}
+		EXPECT_NEAR(aml::dot(a, b), expected, 1e-5f * std::abs(expected));
+
+		aml::DVector<double> converted{aml::size_initializer(size)};
+		aml::scale(converted, a, 0.5);
+		for (std::size_t i = 0; i < size; ++i) {
+			EXPECT_EQ(converted[i], static_cast<double>(a[i]) * 0.5);
+		}
+	}
+}
+
+}
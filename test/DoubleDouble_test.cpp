@@ -0,0 +1,129 @@
+#include <AML/Vector.hpp>
+#include <AML/DoubleDouble.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace {
+
+TEST(double_double_test, error_free_transformations)
+{
+	double error = 0.;
+	EXPECT_EQ(aml::detail::two_sum(1., 1e-20, error), 1.);
+	EXPECT_EQ(error, 1e-20);
+
+	// (1 + 2^-30)^2 = 1 + 2^-29 + 2^-60
+	const double x = 1. + std::ldexp(1., -30);
+	EXPECT_EQ(aml::detail::two_prod(x, x, error), 1. + std::ldexp(1., -29));
+	EXPECT_EQ(error, std::ldexp(1., -60));
+
+	// The constant evaluation uses Dekker's product, the runtime uses FMA if it is fast
+	constexpr aml::double_double product = aml::double_double::product(1. + 0x1p-30, 1. + 0x1p-30);
+	static_assert(product.low() == 0x1p-60);
+	EXPECT_EQ(aml::double_double::product(x, x), product);
+	EXPECT_EQ(aml::double_double::product(0.1, 10.).low(), std::fma(0.1, 10., -1.));
+}
+
+TEST(double_double_test, arithmetic)
+{
+	const aml::double_double one = 1.;
+	const aml::double_double tiny = 1e-20;
+	EXPECT_EQ(static_cast<double>((one + tiny) - one), 1e-20);
+	EXPECT_EQ(((one + tiny) - 1.).high(), 1e-20);
+	EXPECT_EQ(-(one + tiny), (-1.) - tiny);
+
+	// 1/3 to 106 bits
+	const aml::double_double third = one / 3.;
+	EXPECT_NEAR(static_cast<double>((third * 3.) - 1.), 0., 1e-31);
+	EXPECT_NEAR(static_cast<double>((third * aml::double_double(3.)) - 1.), 0., 1e-31);
+	EXPECT_NEAR(static_cast<double>((one / third) - 3.), 0., 1e-30);
+	EXPECT_EQ(third.high(), 1. / 3.);
+	EXPECT_NE(third.low(), 0.);
+
+	// The integers wider than double are exact
+	const aml::double_double large = (std::numeric_limits<std::int64_t>::max)();
+	EXPECT_EQ(large - aml::double_double((std::numeric_limits<std::int64_t>::max)() - 1), one);
+	EXPECT_EQ(static_cast<double>(aml::double_double(-7)), -7.);
+
+	// The low part is kept by the integer conversions
+	const aml::double_double power = std::ldexp(1., 60);
+	EXPECT_EQ(static_cast<std::int64_t>(power + 1.), (std::int64_t{1} << 60) + 1);
+	EXPECT_EQ(static_cast<std::int64_t>(power - 1.), (std::int64_t{1} << 60) - 1);
+	EXPECT_EQ(static_cast<std::uint64_t>(power - 1.), (std::uint64_t{1} << 60) - 1);
+	EXPECT_EQ(static_cast<std::int64_t>(-power - 1.), -(std::int64_t{1} << 60) - 1);
+	EXPECT_EQ(static_cast<std::int64_t>(large), (std::numeric_limits<std::int64_t>::max)());
+	EXPECT_EQ(static_cast<std::int64_t>(-large), -(std::numeric_limits<std::int64_t>::max)());
+	EXPECT_EQ(static_cast<std::int64_t>(power + 0.5), (std::int64_t{1} << 60));
+	EXPECT_EQ(static_cast<std::int64_t>(power - 0.5), (std::int64_t{1} << 60) - 1);
+	// The sums just below the integers are truncated toward zero
+	EXPECT_EQ(static_cast<int>(one - 1e-20), 0);
+	EXPECT_EQ(static_cast<int>(-one + 1e-20), 0);
+	EXPECT_EQ(static_cast<int>(aml::double_double(3.) - 1e-20), 2);
+	EXPECT_EQ(static_cast<int>(aml::double_double(-3.) + 1e-20), -2);
+	EXPECT_EQ(static_cast<int>(aml::double_double(2.5) - 1e-20), 2);
+	EXPECT_EQ(static_cast<std::uint8_t>(aml::double_double(200.) - 1e-20), 199);
+	static_assert(static_cast<int>(aml::double_double(1.) - 1e-20) == 0);
+
+	EXPECT_LT(one, one + tiny);
+	EXPECT_GT(one, one - tiny);
+	EXPECT_LE(one, one);
+	EXPECT_NE(one, one + tiny);
+
+	aml::double_double acc = 0.;
+	for (int i = 0; i < 10; ++i) {
+		acc += 0.1;
+	}
+	// The sums of 0.1 are exact, unlike the ones in double
+	EXPECT_EQ(acc, aml::double_double::product(0.1, 10.));
+}
+
+TEST(double_double_test, accumulation)
+{
+	// The squares of a are not doubles and cancel, so the dot product in double loses all the digits
+	const double a = 1e9 + 1.;
+	const std::size_t triplets = 1001;
+	aml::DVector<double> left{aml::size_initializer(3 * triplets)};
+	aml::DVector<double> right{aml::size_initializer(3 * triplets)};
+	for (std::size_t i = 0; i < triplets; ++i) {
+		left[3 * i] = a;		right[3 * i] = a;
+		left[3 * i + 1] = 1.;	right[3 * i + 1] = 1.;
+		left[3 * i + 2] = -a;	right[3 * i + 2] = a;
+	}
+	EXPECT_EQ(aml::compensated_dot(left, right), aml::double_double(static_cast<double>(triplets)));
+	EXPECT_NE(aml::dot(left, right), static_cast<double>(triplets));
+
+	// The large numbers cancel, the small ones are lost in the double sum
+	aml::DVector<double> values{aml::size_initializer(1000)};
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		values[i] = ((i % 4) == 0) ? 1e20 : (((i % 4) == 2) ? -1e20 : 1.);
+	}
+	EXPECT_EQ(static_cast<double>(aml::compensated_sum(values)), 500.);
+
+	// The small sizes are unrolled
+	const aml::Vector<double, 3> small(1e20, 1., -1e20);
+	EXPECT_EQ(static_cast<double>(aml::compensated_sum(small)), 1.);
+	EXPECT_EQ(static_cast<double>(aml::compensated_dot(aml::DVector<double>(a, 1., -a), aml::DVector<double>(a, 1., a))), 1.);
+}
+
+TEST(double_double_test, vector_element)
+{
+	aml::DVector<aml::double_double> vec{aml::size_initializer(100)};
+	for (std::size_t i = 0; i < vec.size(); ++i) {
+		vec[i] = aml::double_double(1.) / static_cast<double>(i + 1);
+	}
+	const aml::DVector<aml::double_double> doubled = vec + vec;
+	const aml::double_double sum = aml::sum_of(doubled);
+	EXPECT_NEAR(static_cast<double>(sum - aml::sum_of(vec) * 2.), 0., 1e-29);
+
+	// The harmonic number H_100
+	EXPECT_NEAR(static_cast<double>(aml::sum_of(vec)), 5.187377517639621, 1e-15);
+	EXPECT_NEAR(static_cast<double>(aml::dot(vec, vec)), 1.6349839001848923, 1e-15);
+
+	const aml::DVector<double> rounded(vec);
+	EXPECT_EQ(rounded[2], 1. / 3.);
+}
+
+}
@@ -32,4 +32,23 @@ DEFINE_TEST(functions_min)
 	TEST_EQUALS(aml::min(0, 0.f, 1.0), 0.0);
 }
 
+DEFINE_TEST(functions_rounding)
+{
+	TEST_EQUALS(aml::floor(-2.5), -3.0);
+	TEST_EQUALS(aml::ceil(-2.5), -2.0);
+	TEST_EQUALS(aml::round(-2.4), -2.0);
+	TEST_EQUALS(aml::round(-2.5), -3.0);
+	TEST_EQUALS(aml::round(2.5f), 3.f);
+	TEST_EQUALS(aml::round(0.49999997f), 0.f);
+
+	// The numbers out of the range of the integers are integral already
+	TEST_EQUALS(aml::floor(1e30), 1e30);
+	TEST_EQUALS(aml::ceil(-1e30f), -1e30f);
+
+	DEFINE_VAR auto num = -0.5;
+	TEST_EQUALS(aml::floor(num), -1.0);
+	TEST_EQUALS(aml::ceil(num), 0.0);
+	TEST_EQUALS(aml::round<int>(num), -1);
+}
+
 }
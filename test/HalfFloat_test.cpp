@@ -0,0 +1,138 @@
+#include "Testing.hpp"
+
+#include <AML/Vector.hpp>
+#include <AML/HalfFloat.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace {
+
+TEST(half_float_test, float16_conversions)
+{
+	EXPECT_EQ(aml::float16(1.f).bits(), 0x3c00);
+	EXPECT_EQ(aml::float16(-2.f).bits(), 0xc000);
+	EXPECT_EQ(aml::float16(65504.f).bits(), 0x7bff);
+	EXPECT_EQ(aml::float16(0x1p-24f).bits(), 0x0001);
+	EXPECT_EQ(aml::float16(-0.f).bits(), 0x8000);
+	EXPECT_EQ(aml::float16(1e6f).bits(), 0x7c00);
+	EXPECT_EQ(aml::float16(-std::numeric_limits<float>::infinity()).bits(), 0xfc00);
+	EXPECT_TRUE(std::isnan(static_cast<float>(aml::float16(std::numeric_limits<float>::quiet_NaN()))));
+
+	// Ties round to the nearest even
+	EXPECT_EQ(aml::float16(1.f + 0x1p-11f).bits(), 0x3c00);
+	EXPECT_EQ(aml::float16(1.f + 0x3p-11f).bits(), 0x3c02);
+	EXPECT_EQ(aml::float16(0x1p-25f).bits(), 0x0000);
+	EXPECT_EQ(aml::float16(0x3p-25f).bits(), 0x0002);
+	EXPECT_EQ(aml::float16(65520.f).bits(), 0x7c00);
+
+	EXPECT_EQ(static_cast<float>(aml::float16::from_bits(0x0001)), 0x1p-24f);
+	EXPECT_EQ(static_cast<float>(aml::float16::from_bits(0x3555)), 0x1.554p-2f);
+	EXPECT_EQ(static_cast<float>(aml::float16::from_bits(0x7c00)), std::numeric_limits<float>::infinity());
+
+	// Every number which is not NaN is converted to float and back exactly
+	for (std::uint32_t bits = 0; bits <= 0xffff; ++bits) {
+		const auto value = aml::float16::from_bits(static_cast<std::uint16_t>(bits));
+		if (!std::isnan(static_cast<float>(value))) {
+			ASSERT_EQ(aml::float16(static_cast<float>(value)).bits(), bits);
+		}
+	}
+}
+
+TEST(half_float_test, bfloat16_conversions)
+{
+	EXPECT_EQ(aml::bfloat16(1.f).bits(), 0x3f80);
+	EXPECT_EQ(aml::bfloat16(-2.f).bits(), 0xc000);
+	EXPECT_EQ(aml::bfloat16(1e30f).bits(), 0x714a); // 0x7149f2ca
+	EXPECT_EQ(static_cast<float>(aml::bfloat16(1.f + 0x1p-8f)), 1.f);
+	EXPECT_EQ(static_cast<float>(aml::bfloat16(1.f + 0x3p-8f)), 1.f + 0x1p-6f);
+	EXPECT_EQ(static_cast<float>(aml::bfloat16(std::numeric_limits<float>::max())), std::numeric_limits<float>::infinity());
+	EXPECT_TRUE(std::isnan(static_cast<float>(aml::bfloat16(std::numeric_limits<float>::quiet_NaN()))));
+
+	aml::bfloat16 value(3);
+	value += 1.5f;
+	value *= 2.f;
+	EXPECT_EQ(static_cast<float>(value), 9.f);
+}
+
+TEST(half_float_test, convert_n)
+{
+	// The size is not a multiple of the vector width, so the remainder is tested too
+	std::vector<float> values(1001);
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		values[i] = (static_cast<float>(i) - 500.f) * 0.3f;
+	}
+
+	std::vector<aml::float16> halves(values.size());
+	aml::convert_n(values.data(), values.size(), halves.data());
+	std::vector<float> out(values.size());
+	aml::convert_n(halves.data(), halves.size(), out.data());
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		ASSERT_EQ(halves[i].bits(), aml::float16(values[i]).bits());
+		ASSERT_EQ(out[i], static_cast<float>(halves[i]));
+	}
+
+	std::vector<aml::bfloat16> brains(values.size());
+	aml::convert_n(values.data(), values.size(), brains.data());
+	aml::convert_n(brains.data(), brains.size(), out.data());
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		ASSERT_EQ(out[i], static_cast<float>(aml::bfloat16(values[i])));
+	}
+}
+
+TEST(half_float_test, reductions)
+{
+	// Sizes across the conversion blocks
+	for (const std::size_t size : {std::size_t{3}, std::size_t{100}, std::size_t{1001}}) {
+		const auto a = make_dvector<aml::float16>(size, 1.f);
+		const auto b = make_dvector<aml::float16>(size, -2.f);
+
+		aml::DVector<float> fa{aml::size_initializer(size)}, fb{aml::size_initializer(size)};
+		for (std::size_t i = 0; i < size; ++i) {
+			fa[i] = a[i];
+			fb[i] = b[i];
+		}
+
+		// The conversion is exact and the lanes are the same, so the results are the same as the ones of float
+		EXPECT_EQ(aml::dot(a, b), aml::dot(fa, fb));
+		EXPECT_EQ(aml::dist(a), aml::dist(fa));
+		EXPECT_EQ(aml::sum_of(a), aml::sum_of(fa));
+		static_assert(std::is_same_v<decltype(aml::sum_of(a)), float>);
+
+		const auto c = make_dvector<aml::bfloat16>(size, 0.5f);
+		aml::DVector<float> fc{aml::size_initializer(size)};
+		for (std::size_t i = 0; i < size; ++i) {
+			fc[i] = c[i];
+		}
+		EXPECT_EQ(aml::dot(c, c), aml::dot(fc, fc));
+		EXPECT_EQ(aml::sum_of(c), aml::sum_of(fc));
+
+		// The converted blocks are mixed with the vector expressions, which are indexed from the block
+		const auto d = make_dvector<float>(size, 0.75);
+		EXPECT_EQ(aml::dot(a, fb + d), aml::dot(fa, aml::DVector<float>(fb + d)));
+		EXPECT_EQ(aml::dot(d * 2.f, c), aml::dot(aml::DVector<float>(d * 2.f), fc));
+	}
+}
+
+TEST(half_float_test, element_wise)
+{
+	const std::size_t size = 33;
+	const auto a = make_dvector<aml::float16>(size, 1.f);
+	const auto b = make_dvector<aml::float16>(size, -2.f);
+
+	aml::DVector<aml::float16> out{aml::size_initializer(size)};
+	aml::add(out, a, b);
+	for (std::size_t i = 0; i < size; ++i) {
+		EXPECT_EQ(out[i].bits(), aml::float16(a[i] + b[i]).bits());
+	}
+
+	out *= 0.5f;
+	for (std::size_t i = 0; i < size; ++i) {
+		EXPECT_EQ(out[i].bits(), aml::float16((a[i] + b[i]) * 0.5f).bits());
+	}
+}
+
+}
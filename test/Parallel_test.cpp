@@ -0,0 +1,102 @@
+#define AML_PARALLEL_THREADS 4
+#define AML_PARALLEL_THRESHOLD 1024
+#include "Testing.hpp"
+
+#include <AML/Parallel.hpp>
+#include <AML/HalfFloat.hpp>
+#include <AML/DoubleDouble.hpp>
+#include <AML/VectorView.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+
+namespace {
+
+TEST(parallel_test, reductions)
+{
+	for (const std::size_t size : {std::size_t{100}, std::size_t{1024}, std::size_t{100'003}}) {
+		const auto a = make_dvector<double>(size, 1.);
+		const auto b = make_dvector<double>(size, -2.);
+
+		EXPECT_NEAR(aml::dot(aml::par, a, b), aml::dot(a, b), 1e-9 * std::abs(aml::dot(a, b)));
+		EXPECT_NEAR(aml::sum_of(aml::par, a), aml::sum_of(a), 1e-9 * aml::sum_of(a));
+		EXPECT_NEAR(aml::dist(aml::par_unseq, a), aml::dist(a), 1e-9 * aml::dist(a));
+	}
+
+	const aml::DVector<int> i(aml::size_initializer(5000), 2);
+	EXPECT_EQ(aml::dot(aml::par, i, i), 20000);
+	EXPECT_EQ(aml::sum_of(aml::par, i), 10000);
+
+	// The half floats are summed in their accumulation type as in the serial sum
+	const aml::DVector<aml::float16> h(aml::size_initializer(100'000), aml::float16(1.f));
+	static_assert(std::is_same_v<decltype(aml::sum_of(aml::par, h)), float>);
+	EXPECT_EQ(aml::sum_of(aml::par, h), 100'000.f);
+	EXPECT_EQ(aml::sum_of(aml::par, h), aml::sum_of(h));
+
+	// The compensated accumulator sums the chunks and adds them together without the rounding of double
+	aml::DVector<double> ones(aml::size_initializer(100'001), 1.);
+	ones[0] = 1e16;
+	const auto compensated = aml::sum_of<aml::double_double>(aml::par, ones);
+	static_assert(std::is_same_v<decltype(compensated), const aml::double_double>);
+	EXPECT_EQ(compensated, aml::sum_of<aml::double_double>(ones));
+	EXPECT_EQ(static_cast<std::int64_t>(compensated), std::int64_t{10'000'000'000'100'000});
+}
+
+#ifdef AML_DETERMINISTIC_REDUCTION
+TEST(parallel_test, deterministic_reductions)
+{
+	for (const std::size_t size : {std::size_t{1024}, std::size_t{4096 * 3}, std::size_t{100'003}}) {
+		const auto a = make_dvector<double>(size, 0.1);
+		const auto b = make_dvector<double>(size, -0.3);
+
+		EXPECT_EQ(aml::dot(aml::par, a, b), aml::dot(a, b));
+		EXPECT_EQ(aml::sum_of(aml::par, a), aml::sum_of(a));
+		EXPECT_EQ(aml::dist(aml::par_unseq, a), aml::dist(a));
+	}
+}
+#endif
+
+TEST(parallel_test, element_wise)
+{
+	const std::size_t size = 50'001;
+	const auto a = make_dvector<double>(size, 1.);
+	const auto b = make_dvector<double>(size, 3.);
+
+	aml::DVector<double> out{aml::size_initializer(size)};
+	aml::assign(aml::par, out, a + b * 2.);
+	EXPECT_TRUE(aml::is_equal(aml::par, out, a + b * 2.));
+	EXPECT_EQ(out, a + b * 2.);
+
+	aml::add(aml::par, out, a, b);
+	EXPECT_EQ(out, a + b);
+	aml::sub(aml::par, out, out, b);
+	EXPECT_TRUE(aml::is_equal(aml::par, out, a));
+	aml::scale(aml::par_unseq, out, a, 0.5);
+	EXPECT_EQ(out, a * 0.5);
+
+	out[size - 1] += 1.;
+	EXPECT_FALSE(aml::is_equal(aml::par, out, a * 0.5));
+	EXPECT_FALSE(aml::is_equal(aml::par, out, b));
+
+	const aml::DVector<double> evaluated = aml::evaluate(aml::par, a - b);
+	EXPECT_EQ(evaluated, a - b);
+
+	std::vector<double> memory(size);
+	aml::assign(aml::par, aml::VectorView<double>(memory), a);
+	EXPECT_DOUBLE_EQ(memory[size - 1], a[size - 1]);
+}
+
+TEST(parallel_test, normalize)
+{
+	const auto a = make_dvector<double>(20'000, 0.25);
+	const aml::DVector<double> n = aml::normalize(aml::par, a);
+	EXPECT_EQ(n, aml::normalize(a));
+	EXPECT_NEAR(aml::dist(n), 1., 1e-12);
+
+	const aml::Vector<float, 2> s(3.f, 4.f);
+	EXPECT_EQ(aml::normalize(aml::par, s), (aml::Vector<float, 2>(0.6f, 0.8f)));
+}
+
+}
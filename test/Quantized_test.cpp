@@ -0,0 +1,146 @@
+#include "Testing.hpp"
+
+#include <AML/Vector.hpp>
+#include <AML/Quantized.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+double dot_of(const aml::DVector<float>& left, const aml::DVector<float>& right)
+{
+	double out = 0.;
+	for (std::size_t i = 0; i < left.size(); ++i) {
+		out += static_cast<double>(left[i]) * static_cast<double>(right[i]);
+	}
+	return out;
+}
+
+TEST(quantized_test, quantization)
+{
+	const auto vec = make_wave_dvector(1001, 0.5f, 3.f, 0.5f);
+	const aml::QuantizedVector quantized(vec);
+	ASSERT_EQ(quantized.size(), vec.size());
+
+	const auto params = quantized.params();
+	EXPECT_GT(params.scale, 0.f);
+	const auto restored = quantized.dequantize();
+	for (std::size_t i = 0; i < vec.size(); ++i) {
+		EXPECT_LE(std::abs(restored[i] - vec[i]), params.scale * 0.5001f);
+		EXPECT_EQ(restored[i], quantized[i]);
+	}
+
+	// Zero is quantized exactly, the ties round to even and the numbers out of the range saturate.
+	// The values are repeated, so both the vectorized loop and the remainder convert them
+	const aml::quantization fixed{0.5f, 10};
+	const float cases[] = {0.f, 1.25f, 1.75f, -1000.f, 1000.f};
+	float values[25];
+	for (std::size_t i = 0; i < 25; ++i) {
+		values[i] = cases[i % 5];
+	}
+	std::int8_t codes[25];
+	aml::quantize_n(values, 25, fixed, codes);
+	for (std::size_t i = 0; i < 25; i += 5) {
+		EXPECT_EQ(codes[i], 10);
+		EXPECT_EQ(codes[i + 1], 12);
+		EXPECT_EQ(codes[i + 2], 14);
+		EXPECT_EQ(codes[i + 3], -128);
+		EXPECT_EQ(codes[i + 4], 127);
+	}
+
+	float restored_values[5];
+	aml::dequantize_n(codes, 5, fixed, restored_values);
+	EXPECT_EQ(restored_values[0], 0.f);
+	EXPECT_EQ(restored_values[1], 1.f);
+	EXPECT_EQ(restored_values[4], 58.5f);
+}
+
+TEST(quantized_test, code_kernels)
+{
+	// The extreme codes check the overflow of the blocks and the sign flip of the VNNI kernel.
+	// The sizes are not multiples of the vector widths, so the remainders are tested too
+	for (const std::size_t size : {std::size_t{1}, std::size_t{63}, std::size_t{200}, std::size_t{3 * 65536 + 77}}) {
+		for (const int fill : {-128, 127, 0}) {
+			std::vector<std::int8_t> left(size), right(size);
+			std::int64_t right_sum = 0;
+			for (std::size_t i = 0; i < size; ++i) {
+				left[i] = static_cast<std::int8_t>((fill != 0) ? fill : static_cast<int>(i * 37 % 256) - 128);
+				right[i] = static_cast<std::int8_t>((fill != 0) ? -128 : static_cast<int>(i * 91 % 256) - 128);
+				right_sum += right[i];
+			}
+
+			std::int64_t expected = 0;
+			for (std::size_t i = 0; i < size; ++i) {
+				expected += left[i] * right[i];
+			}
+			EXPECT_EQ(aml::detail::dot_codes_generic(left.data(), right.data(), size), expected);
+			EXPECT_EQ(aml::detail::dot_codes(left.data(), right.data(), size, right_sum), expected);
+
+			std::int64_t expected_dist = 0;
+			for (std::size_t i = 0; i < size; ++i) {
+				expected_dist += (left[i] - right[i]) * (left[i] - right[i]);
+			}
+			EXPECT_EQ(aml::detail::dist_codes_generic(left.data(), right.data(), size), expected_dist);
+			EXPECT_EQ(aml::detail::dist_codes(left.data(), right.data(), size), expected_dist);
+		}
+	}
+}
+
+TEST(quantized_test, similarity)
+{
+	const auto a = make_wave_dvector(1000, 0.25f, 3.f, 0.25f);
+	const auto b = make_wave_dvector(1000, -0.75f, 3.f, -0.75f);
+	const aml::QuantizedVector qa(a);
+	const aml::QuantizedVector qb(b);
+
+	// The integer path gives the dot product of the dequantized values
+	const auto da = qa.dequantize();
+	const auto db = qb.dequantize();
+	EXPECT_NEAR(aml::quantized_dot(qa, qb), dot_of(da, db), 1e-6 * std::abs(dot_of(da, db)));
+	EXPECT_NEAR(qa.dist_squared(), dot_of(da, da), 1e-6 * dot_of(da, da));
+	EXPECT_NEAR(aml::quantized_dist_squared(qa, qb), aml::sqr(aml::dist(da - db)), 1e-6f * aml::quantized_dist_squared(qa, qb));
+
+	// Against the float path the error is bounded by the quantization step
+	const double dot = dot_of(a, b);
+	const double bound = 0.5 * (static_cast<double>(qa.params().scale) * std::sqrt(dot_of(b, b)) + static_cast<double>(qb.params().scale) * std::sqrt(dot_of(a, a)));
+	EXPECT_NEAR(aml::quantized_dot(qa, qb), dot, bound);
+
+	const double cosine = dot / std::sqrt(dot_of(a, a) * dot_of(b, b));
+	EXPECT_NEAR(aml::quantized_cosine(qa, qb), cosine, 1e-2);
+	EXPECT_NEAR(aml::quantized_cosine(qa, qa), 1.f, 1e-6f);
+	EXPECT_NEAR(aml::quantized_dist_squared(qa, qa), 0.f, 1e-6f);
+
+	// The close vectors with the shared parameters: the norms are large and the distance is two code steps, the integer kernel is exact
+	auto c = make_wave_dvector(1'000'000, 0.5f, 3.f);
+	const aml::QuantizedVector qc(c);
+	c[500'000] += 2.f * qc.params().scale;
+	const aml::QuantizedVector qd(c, qc.params());
+	const double step = qc.params().scale;
+	double dist_cd = 0.;
+	for (std::size_t i = 0; i < c.size(); ++i) {
+		const double diff = step * (qc.data()[i] - qd.data()[i]);
+		dist_cd += diff * diff;
+	}
+	ASSERT_GT(dist_cd, 0.);
+	EXPECT_EQ(aml::quantized_dist_squared(qc, qd), static_cast<float>(dist_cd));
+
+	// The different parameters sum the differences of the dequantized values
+	const aml::QuantizedVector qe(make_wave_dvector(1'000'000, 0.5f, 3.5f, 0.25f));
+	ASSERT_NE(qe.params().scale, qc.params().scale);
+	const auto dc = qc.dequantize();
+	const auto de = qe.dequantize();
+	double dist_ce = 0.;
+	for (std::size_t i = 0; i < c.size(); ++i) {
+		dist_ce += aml::sqr(static_cast<double>(dc[i]) - static_cast<double>(de[i]));
+	}
+	EXPECT_NEAR(aml::quantized_dist_squared(qc, qe), dist_ce, 1e-5 * dist_ce);
+
+	const aml::QuantizedVector zero(aml::DVector<float>{aml::size_initializer(1000)});
+	EXPECT_EQ(aml::quantized_cosine(qa, zero), 0.f);
+	EXPECT_EQ(zero.code_square_sum(), static_cast<std::int64_t>(1000) * zero.params().zero_point * zero.params().zero_point);
+}
+
+}
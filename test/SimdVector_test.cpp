@@ -0,0 +1,80 @@
+
+#include <AML/Vector.hpp>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using namespace aml::short_vector_alias;
+using namespace aml::VI;
+
+#ifdef AML_SIMD_VECTOR
+static_assert(alignof(vec4f) == 16);
+static_assert(sizeof(vec3f) == 16);
+static_assert(alignof(vec2d) == 16);
+#endif
+
+TEST(simd_vector_test, dot)
+{
+	const vec2f a2(1.f, 2.f), b2(3.f, -4.f);
+	EXPECT_FLOAT_EQ(aml::dot(a2, b2), -5.f);
+
+	const vec3f a3(1.f, 2.f, 3.f), b3(4.f, -5.f, 6.f);
+	EXPECT_FLOAT_EQ(aml::dot(a3, b3), 12.f);
+
+	const vec4f a4(1.f, 2.f, 3.f, 4.f), b4(-1.f, 2.f, -3.f, 4.f);
+	EXPECT_FLOAT_EQ(aml::dot(a4, b4), 10.f);
+
+	const vec2d a2d(0.5, 2.), b2d(4., 0.25);
+	EXPECT_DOUBLE_EQ(aml::dot(a2d, b2d), 2.5);
+
+	const vec3d a3d(1., 2., 3.), b3d(4., -5., 6.);
+	EXPECT_DOUBLE_EQ(aml::dot(a3d, b3d), 12.);
+
+	const vec4d a4d(1., 2., 3., 4.), b4d(-1., 2., -3., 4.);
+	EXPECT_DOUBLE_EQ(aml::dot(a4d, b4d), 10.);
+}
+
+TEST(simd_vector_test, dist)
+{
+	EXPECT_FLOAT_EQ(aml::dist(vec2f(3.f, 4.f)), 5.f);
+	EXPECT_FLOAT_EQ(aml::dist(vec3f(2.f, 3.f, 6.f)), 7.f);
+	EXPECT_FLOAT_EQ(aml::dist(vec4f(1.f, 1.f, 1.f, 1.f)), 2.f);
+	EXPECT_DOUBLE_EQ(aml::dist(vec2d(3., 4.)), 5.);
+	EXPECT_DOUBLE_EQ(aml::dist(vec3d(2., 3., 6.)), 7.);
+	EXPECT_DOUBLE_EQ(aml::dist(vec4d(1., 1., 1., 1.)), 2.);
+}
+
+TEST(simd_vector_test, normalize)
+{
+	const vec3f n3 = aml::normalize(vec3f(2.f, 3.f, 6.f));
+	EXPECT_FLOAT_EQ(n3[X], 2.f / 7.f);
+	EXPECT_FLOAT_EQ(n3[Y], 3.f / 7.f);
+	EXPECT_FLOAT_EQ(n3[Z], 6.f / 7.f);
+
+	const vec4f n4 = aml::normalize(vec4f(0.f, 0.f, -2.f, 0.f));
+	EXPECT_EQ(n4, vec4f(0.f, 0.f, -1.f, 0.f));
+
+	const vec2d n2d = aml::normalize(vec2d(3., 4.));
+	EXPECT_DOUBLE_EQ(n2d[X], 0.6);
+	EXPECT_DOUBLE_EQ(n2d[Y], 0.8);
+
+	vec3f out;
+	aml::normalize_into(out, vec3f(2.f, 3.f, 6.f));
+	EXPECT_FLOAT_EQ(out[Y], 3.f / 7.f);
+}
+
+TEST(simd_vector_test, cross)
+{
+	const vec3f a(1.f, 2.f, 3.f), b(4.f, 5.f, 6.f);
+	EXPECT_EQ(aml::cross(a, b), vec3f(-3.f, 6.f, -3.f));
+
+	const vec3f i(1.f, 0.f, 0.f), j(0.f, 1.f, 0.f);
+	EXPECT_EQ(aml::cross(i, j), vec3f(0.f, 0.f, 1.f));
+
+	vec3f out = a;
+	aml::cross_into(out, out, b);
+	EXPECT_EQ(out, vec3f(-3.f, 6.f, -3.f));
+}
+
+}
@@ -1,6 +1,10 @@
 #pragma once
 
 #include <AML/Functions.hpp>
+#include <AML/Vector.hpp>
+
+#include <cmath>
+#include <cstddef>
 
 //#define NO_TESTS
 
@@ -41,3 +45,30 @@
 #define FORCE_COMPILE_TIME(...) \
 	static_assert((([&]() __VA_ARGS__ ()), void(), true))
 
+
+/**
+	@brief Creates the dynamic vector with the repeating ramp <tt>(i % 13) * 0.25 + shift</tt>
+	@details The ramp values are exact in every floating point type, so the results of the different kernels can be compared exactly
+*/
+template<class T = float>
+aml::DVector<T> make_dvector(const std::size_t size, const double shift = 0.)
+{
+	aml::DVector<T> out{aml::size_initializer(size)};
+	for (std::size_t i = 0; i < size; ++i) {
+		out[i] = static_cast<T>(static_cast<double>(i % 13) * 0.25 + shift);
+	}
+	return out;
+}
+
+/**
+	@brief Creates the dynamic vector with the sine wave <tt>sin(0.37 * i + phase) * amplitude + offset</tt>
+	@details The elements change their sign, unlike the ones of make_dvector()
+*/
+inline aml::DVector<float> make_wave_dvector(const std::size_t size, const float phase, const float amplitude = 1.f, const float offset = 0.f)
+{
+	aml::DVector<float> out{aml::size_initializer(size)};
+	for (std::size_t i = 0; i < size; ++i) {
+		out[i] = std::sin(static_cast<float>(i) * 0.37f + phase) * amplitude + offset;
+	}
+	return out;
+}
@@ -0,0 +1,94 @@
+
+#include <AML/VectorArray.hpp>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+TEST(vector_array_test, transpose)
+{
+	const std::vector<aml::Vector<int, 3>> vecs = {
+		aml::Vector(1, 2, 3), aml::Vector(4, 5, 6), aml::Vector(7, 8, 9), aml::Vector(10, 11, 12), aml::Vector(13, 14, 15)
+	};
+
+	const aml::VectorArray<int, 3> arr(vecs);
+	ASSERT_EQ(arr.size(), 5);
+
+	EXPECT_EQ(arr.column(0)[1], 4);
+	EXPECT_EQ(arr.column(1)[1], 5);
+	EXPECT_EQ(arr.column(2)[4], 15);
+	EXPECT_EQ(arr[3], aml::Vector(10, 11, 12));
+
+	const auto back = arr.to_vectors();
+	ASSERT_EQ(back.size(), vecs.size());
+	for (std::size_t i = 0; i < vecs.size(); ++i) {
+		EXPECT_EQ(back[i], vecs[i]);
+	}
+}
+
+TEST(vector_array_test, transpose_blocks)
+{
+	// Spans several transpose blocks with the partial last block
+	std::vector<aml::Vector<int, 4>> vecs;
+	for (int i = 0; i < 1000; ++i) {
+		vecs.push_back(aml::Vector(i, -i, i * 2, i * 3));
+	}
+
+	const aml::VectorArray<int, 4> arr(vecs);
+	ASSERT_EQ(arr.size(), vecs.size());
+	EXPECT_EQ(arr[999], aml::Vector(999, -999, 1998, 2997));
+	EXPECT_EQ(arr.column(3)[300], 900);
+
+	EXPECT_EQ(arr.to_vectors(), vecs);
+}
+
+TEST(vector_array_test, functions)
+{
+	aml::VectorArray<float, 3> a;
+	a.push_back(aml::Vector(1.f, 2.f, 3.f));
+	a.push_back(aml::Vector(2.f, 3.f, 6.f));
+
+	aml::VectorArray<float, 3> b;
+	b.push_back(aml::Vector(4.f, 5.f, 6.f));
+	b.push_back(aml::Vector(1.f, 0.f, 0.f));
+
+	const auto a_dot_b = aml::dot_each(a, b);
+	ASSERT_EQ(a_dot_b.size(), 2);
+	EXPECT_FLOAT_EQ(a_dot_b[0], 32.f);
+	EXPECT_FLOAT_EQ(a_dot_b[1], 2.f);
+
+	const auto a_cross_b = aml::cross_each(a, b);
+	EXPECT_EQ(a_cross_b[0], aml::cross(a[0], b[0]));
+	EXPECT_EQ(a_cross_b[1], aml::cross(a[1], b[1]));
+
+	const auto dist_a = aml::dist_each(a);
+	EXPECT_FLOAT_EQ(dist_a[1], 7.f);
+
+	const auto normalize_a = aml::normalize_each(a);
+	EXPECT_EQ(normalize_a[1], aml::Vector(2.f / 7.f, 3.f / 7.f, 6.f / 7.f));
+}
+
+TEST(vector_array_test, operators)
+{
+	aml::VectorArray<int, 2> a;
+	a.push_back(aml::Vector(1, 2));
+	a.push_back(aml::Vector(3, 4));
+
+	aml::VectorArray<int, 2> b;
+	b.push_back(aml::Vector(10, 20));
+	b.push_back(aml::Vector(30, 40));
+
+	EXPECT_EQ((a + b)[1], aml::Vector(33, 44));
+	EXPECT_EQ((b - a)[0], aml::Vector(9, 18));
+	EXPECT_EQ((a * 3)[1], aml::Vector(9, 12));
+	EXPECT_EQ((2 * a)[0], aml::Vector(2, 4));
+	EXPECT_EQ((b / 10)[1], aml::Vector(3, 4));
+
+	a += b;
+	EXPECT_EQ(a[0], aml::Vector(11, 22));
+	a -= b;
+	a *= 2;
+	EXPECT_EQ(a[1], aml::Vector(6, 8));
+}
+
+}
@@ -0,0 +1,58 @@
+#include <AML/Vector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+
+namespace {
+
+using namespace aml::short_vector_alias;
+
+#ifdef AML_CONTIGUOUS_VECTOR
+static_assert(std::is_same_v<vec3f::iterator, float*>);
+static_assert(std::is_same_v<vec4d::const_iterator, const double*>);
+#else
+static_assert(std::is_same_v<vec3f::iterator, aml::IndexIterator<vec3f>>);
+#endif
+static_assert(std::is_same_v<aml::Vector<int, 6>::iterator, int*>);
+
+TEST(static_vector_iterator_test, algorithms)
+{
+	const vec4f a(1.f, 2.f, 3.f, 4.f);
+	EXPECT_FLOAT_EQ(std::accumulate(a.begin(), a.end(), 0.f), 10.f);
+	EXPECT_EQ(a.end() - a.begin(), 4);
+
+	vec4f b(aml::zero);
+	std::copy(a.cbegin(), a.cend(), b.begin());
+	EXPECT_EQ(a, b);
+
+	std::transform(a.begin(), a.end(), b.begin(), [](const float val) { return val * 2.f; });
+	const vec4f b_ans(2.f, 4.f, 6.f, 8.f);
+	EXPECT_EQ(b, b_ans);
+
+	vec3i c(3, 1, 2);
+	std::sort(c.begin(), c.end());
+	const vec3i c_ans(1, 2, 3);
+	EXPECT_EQ(c, c_ans);
+}
+
+TEST(static_vector_iterator_test, data)
+{
+	aml::Vector<int, 6> a(1, 2, 3, 4, 5, 6);
+	EXPECT_EQ(a.data(), &a[0]);
+	EXPECT_EQ(a.data() + 5, &a[5]);
+
+#ifdef AML_CONTIGUOUS_VECTOR
+	vec4d b(1., 2., 3., 4.);
+	EXPECT_EQ(b.data(), &b.x);
+	EXPECT_EQ(b.data() + 3, &b.w);
+	EXPECT_EQ(&*b.begin(), &b.x);
+
+	b.y = 5.;
+	EXPECT_EQ(b[1], 5.);
+	EXPECT_EQ(b.end() - b.begin(), 4);
+#endif
+}
+
+}
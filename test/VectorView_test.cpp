@@ -0,0 +1,176 @@
+#include <AML/VectorView.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+namespace {
+
+TEST(vector_view_test, construct)
+{
+	float buffer[] = {1.f, 2.f, 3.f, 4.f};
+
+	const aml::VectorView a(buffer, 4);
+	static_assert(std::is_same_v<decltype(a), const aml::VectorView<float>>);
+	ASSERT_EQ(a.size(), 4);
+	EXPECT_EQ(a.data(), buffer);
+	EXPECT_FLOAT_EQ(a[2], 3.f);
+
+	const aml::VectorView b(buffer);
+	static_assert(std::is_same_v<decltype(b), const aml::VectorView<float, 4>>);
+	static_assert(!decltype(b)::is_dynamic());
+	EXPECT_EQ(b.size(), 4);
+
+	const std::vector<int> vec{1, 2, 3};
+	const aml::VectorView c(vec);
+	static_assert(std::is_same_v<decltype(c), const aml::ConstVectorView<int>>);
+	EXPECT_EQ(c.size(), 3);
+
+	aml::DVector<double> dvec(1., 2., 3.);
+	const aml::VectorView d(dvec);
+	static_assert(std::is_same_v<decltype(d), const aml::VectorView<double>>);
+	EXPECT_EQ(d.data(), dvec.data());
+
+	const aml::ConstVectorView<double> e = d;
+	EXPECT_EQ(e.size(), 3);
+
+	const aml::VectorView f = d.subview(1, 2);
+	EXPECT_EQ(f.size(), 2);
+	EXPECT_DOUBLE_EQ(f[0], 2.);
+}
+
+TEST(vector_view_test, operators)
+{
+	const int abuf[] = {1, -2, 3, 4};
+	const std::vector<int> bbuf{5, 6, -7, 8};
+
+	const aml::ConstVectorView<int> a(abuf, 4);
+	const aml::VectorView b(bbuf);
+
+	const aml::DVector<int> a_plus_b = a + b;
+	const aml::DVector<int> a_plus_b_ans(6, 4, -4, 12);
+	EXPECT_EQ(a_plus_b, a_plus_b_ans);
+
+	const aml::DVector<int> a_minus_b_mul = (a - b) * 2;
+	const aml::DVector<int> a_minus_b_mul_ans(-8, -16, 20, -8);
+	EXPECT_EQ(a_minus_b_mul, a_minus_b_mul_ans);
+
+	const aml::DVector<int> neg_a = -a;
+	const aml::DVector<int> neg_a_ans(-1, 2, -3, -4);
+	EXPECT_EQ(neg_a, neg_a_ans);
+
+	const aml::DVector<int> c(1, 1, 1, 1);
+	const aml::DVector<int> c_plus_a = c + a;
+	const aml::DVector<int> c_plus_a_ans(2, -1, 4, 5);
+	EXPECT_EQ(c_plus_a, c_plus_a_ans);
+
+	EXPECT_EQ(a, aml::DVector<int>(1, -2, 3, 4));
+	EXPECT_NE(a, b);
+	EXPECT_EQ(a, a);
+
+	const aml::Vector<int, 4> d(1, 2, 3, 4);
+	const aml::ConstVectorView<int, 4> e(abuf);
+	const aml::Vector<int, 4> d_plus_e = d + e;
+	const aml::Vector<int, 4> d_plus_e_ans(2, 0, 6, 8);
+	EXPECT_EQ(d_plus_e, d_plus_e_ans);
+}
+
+TEST(vector_view_test, output)
+{
+	std::array<float, 3> out{};
+	const aml::VectorView view(out);
+	static_assert(std::is_same_v<decltype(view), const aml::VectorView<float, 3>>);
+
+	const aml::DVector<float> a(1.f, 2.f, 3.f);
+	const aml::DVector<float> b(4.f, 5.f, 6.f);
+
+	view = a + b * 2.f;
+	EXPECT_FLOAT_EQ(out[0], 9.f);
+	EXPECT_FLOAT_EQ(out[1], 12.f);
+	EXPECT_FLOAT_EQ(out[2], 15.f);
+
+	view -= a;
+	view *= 0.5f;
+	EXPECT_FLOAT_EQ(out[0], 4.f);
+	EXPECT_FLOAT_EQ(out[2], 6.f);
+
+	float other[] = {0.f, 0.f, 0.f};
+	aml::VectorView<float, 3> other_view(other);
+	other_view = view;
+	EXPECT_FLOAT_EQ(other[1], 5.f);
+	EXPECT_NE(other_view.data(), view.data());
+
+	aml::DVector<float> c(aml::size_initializer(3));
+	c += view;
+	EXPECT_EQ(c, view);
+}
+
+TEST(vector_view_test, functions)
+{
+	const double abuf[] = {3., 0., 4.};
+	const double bbuf[] = {1., 2., 3.};
+
+	const aml::ConstVectorView<double> a(abuf, 3);
+	const aml::ConstVectorView<double> b(bbuf, 3);
+
+	EXPECT_DOUBLE_EQ(aml::dot(a, b), 15.);
+	EXPECT_DOUBLE_EQ(aml::dist(a), 5.);
+	EXPECT_DOUBLE_EQ(aml::sum_of(b), 6.);
+
+	const aml::DVector<double> a_norm = aml::normalize(a);
+	const aml::DVector<double> a_norm_ans(0.6, 0., 0.8);
+	EXPECT_EQ(a_norm, a_norm_ans);
+
+	const aml::DVector<double> a_cross_b = aml::cross(a, b);
+	const aml::DVector<double> a_cross_b_ans(-8., -5., 6.);
+	EXPECT_EQ(a_cross_b, a_cross_b_ans);
+
+	const aml::ConstVectorView<double, 3> c(abuf);
+	const aml::Vector<double, 3> c_norm = aml::normalize(c);
+	EXPECT_DOUBLE_EQ(c_norm[2], 0.8);
+}
+
+
+TEST(vector_view_test, output_kernels)
+{
+	const aml::Vector<float, 3> a(1.f, 2.f, 3.f);
+	const aml::Vector<float, 3> b(4.f, -5.f, 6.f);
+
+	aml::Vector<float, 3> s;
+	aml::add(s, a, b);
+	EXPECT_EQ(s, (aml::Vector<float, 3>(5.f, -3.f, 9.f)));
+	aml::sub(s, s, b);
+	EXPECT_EQ(s, a);
+	aml::scale(s, b, 2.f);
+	EXPECT_EQ(s, (aml::Vector<float, 3>(8.f, -10.f, 12.f)));
+	aml::cross_into(s, a, b);
+	EXPECT_EQ(s, aml::cross(a, b));
+	aml::cross_into(s, s, b);
+	EXPECT_EQ(s, aml::cross(aml::cross(a, b), b));
+
+	aml::DVector<double> d(aml::size_initializer(3));
+	const double* const d_data = d.data();
+	const aml::DVector<double> c(3., 0., 4.);
+	aml::add(d, c, a);
+	EXPECT_EQ(d, aml::DVector<double>(4., 2., 7.));
+	aml::normalize_into(d, c);
+	EXPECT_EQ(d, aml::DVector<double>(0.6, 0., 0.8));
+	aml::cross_into(d, c, a);
+	EXPECT_EQ(d, aml::cross(c, a));
+	EXPECT_EQ(d.data(), d_data);
+
+	double buf[4] = {};
+	const aml::VectorView<double> view(buf + 1, 3);
+	aml::sub(view, c, a);
+	EXPECT_DOUBLE_EQ(buf[0], 0.);
+	EXPECT_DOUBLE_EQ(buf[1], 2.);
+	EXPECT_DOUBLE_EQ(buf[2], -2.);
+	EXPECT_DOUBLE_EQ(buf[3], 1.);
+	aml::scale(view, view, 0.5);
+	EXPECT_DOUBLE_EQ(buf[3], 0.5);
+	aml::normalize_into(aml::VectorView<double, 3>(buf + 0), c);
+	EXPECT_DOUBLE_EQ(buf[2], 0.8);
+}
+
+}
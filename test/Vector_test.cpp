@@ -202,6 +202,19 @@ DEFINE_TEST(vector_resize)
 	TEST_EQUALS((vec1.resize<3, float>()), aml::Vector(1.f, 2.f, 3.f));
 }
 
+DEFINE_TEST(vector_large_operations)
+{
+	// Larger than AML_VECTOR_UNROLL_MAX, so the operations use the runtime loop
+	DEFINE_VAR aml::Vector<int, 20> vec1(aml::one);
+	DEFINE_VAR aml::Vector<int, 20> vec2 = vec1 * 3;
+
+	TEST_EQUALS((vec1 + vec2)[19], 4);
+	TEST_EQUALS((vec2 - vec1)[0], 2);
+	TEST_EQUALS(aml::dot(vec1, vec2), 60);
+	TEST_EQUALS(aml::sum_of(vec2), 60);
+	TEST_TRUE(vec1 * 3 == vec2);
+}
+
 DEFINE_TEST(vector_to_array)
 {
 	DEFINE_VAR auto arr = aml::Vector(1, 2, 3).to_array();